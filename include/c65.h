@@ -30,12 +30,17 @@
 
 enum {
 	C65_ACTION_BREAKPOINT_CLEAR = 0, /* Breakpoint clear */
+	C65_ACTION_BREAKPOINT_CONDITION, /* Breakpoint condition */
 	C65_ACTION_BREAKPOINT_SET, /* Breakpoint set */
 	C65_ACTION_CYCLE, /* Cycle count */
 	C65_ACTION_INTERRUPT_PENDING, /* Interrupt pending state */
+	C65_ACTION_READ_ATTRIBUTE, /* Read page attributes */
+	C65_ACTION_READ_BANKING, /* Read memory banking state */
 	C65_ACTION_READ_BYTE, /* Read memory byte */
+	C65_ACTION_READ_ENGINE, /* Read processor engine */
 	C65_ACTION_READ_REGISTER, /* Read processor register */
 	C65_ACTION_READ_STATUS, /* Read processor status */
+	C65_ACTION_READ_TIMING, /* Read processor timing */
 	C65_ACTION_READ_WORD, /* Read memory word */
 	C65_ACTION_STACK_OVERFLOW, /* Stack overflow status */
 	C65_ACTION_STACK_UNDERFLOW, /* Stack underflow status */
@@ -44,19 +49,59 @@ enum {
 	C65_ACTION_WATCH_CLEAR, /* Watch clear */
 	C65_ACTION_WATCH_SET, /* Watch set */
 	C65_ACTION_WINDOW_SHOW, /* Show window */
+	C65_ACTION_WRITE_ATTRIBUTE, /* Write page attributes */
+	C65_ACTION_WRITE_BANKING, /* Write memory banking state (off by default) */
 	C65_ACTION_WRITE_BYTE, /* Write memory byte */
+	C65_ACTION_WRITE_ENGINE, /* Write processor engine */
 	C65_ACTION_WRITE_REGISTER, /* Write processor register */
 	C65_ACTION_WRITE_STATUS, /* Write processor status */
+	C65_ACTION_WRITE_TIMING, /* Write processor timing */
 	C65_ACTION_WRITE_WORD, /* Write memory word */
 };
 
 #define C65_ACTION_MAX C65_ACTION_WRITE_WORD
 
+enum {
+	C65_ATTRIBUTE_READ_ONLY = 0, /* Read-only page */
+	C65_ATTRIBUTE_NO_EXECUTE, /* No-execute page (fetches fault and stop the processor) */
+	C65_ATTRIBUTE_MMIO, /* Memory-mapped IO page */
+};
+
+#define C65_ATTRIBUTE_MAX C65_ATTRIBUTE_MMIO
+
+enum {
+	C65_COMPARE_EQUAL = 0, /* Equal comparison (==) */
+	C65_COMPARE_NOT_EQUAL, /* Not-equal comparison (!=) */
+	C65_COMPARE_LESS, /* Less-than comparison (<) */
+	C65_COMPARE_LESS_EQUAL, /* Less-than-or-equal comparison (<=) */
+	C65_COMPARE_GREATER, /* Greater-than comparison (>) */
+	C65_COMPARE_GREATER_EQUAL, /* Greater-than-or-equal comparison (>=) */
+};
+
+#define C65_COMPARE_MAX C65_COMPARE_GREATER_EQUAL
+
+enum {
+	C65_CONDITION_HIT = 0, /* Breakpoint hit count condition */
+	C65_CONDITION_MEMORY, /* Memory byte condition */
+	C65_CONDITION_REGISTER, /* Processor register condition */
+	C65_CONDITION_STATUS, /* Processor status condition */
+};
+
+#define C65_CONDITION_MAX C65_CONDITION_STATUS
+
+enum {
+	C65_ENGINE_INTERPRETER = 0, /* Instruction interpreter engine */
+	C65_ENGINE_BLOCK, /* Basic-block translation engine */
+};
+
+#define C65_ENGINE_MAX C65_ENGINE_BLOCK
+
 enum {
 	C65_EVENT_BREAKPOINT = 0, /* Breakpoint event */
 	C65_EVENT_ILLEGAL_INSTRUCTION, /* Illegal instruction event */
 	C65_EVENT_INTERRUPT_ENTRY, /* Interrupt entry event */
 	C65_EVENT_INTERRUPT_EXIT, /* Interrupt exit event */
+	C65_EVENT_PROTECTION_FAULT, /* Page protection fault event (value is the attribute mask) */
 	C65_EVENT_STACK_OVERFLOW, /* Stack overflow event */
 	C65_EVENT_STACK_UNDERFLOW, /* Stack underflow event */
 	C65_EVENT_STOP_ENTRY, /* Stop entry event */
@@ -66,9 +111,12 @@ enum {
 	C65_EVENT_WAIT_ENTRY, /* Wait entry event */
 	C65_EVENT_WAIT_EXIT, /* Wait exit event */
 	C65_EVENT_WATCH, /* Memory watch event */
+	C65_EVENT_WATCH_READ, /* Memory read watch event */
 };
 
-#define C65_EVENT_MAX C65_EVENT_WATCH
+#define C65_EVENT_MAX C65_EVENT_WATCH_READ
+
+#define C65_EVENT_RING_LENGTH 1024 /* Event ring length, in entries */
 
 enum {
 	C65_INTERRUPT_NON_MASKABLE = 0, /* Non-maskable interrupt (NMI) */
@@ -77,6 +125,8 @@ enum {
 
 #define C65_INTERRUPT_MAX C65_INTERRUPT_MASKABLE
 
+#define C65_MEMORY_VIEW_DIRTY_LENGTH 8 /* Dirty page bitmap length, in double-words */
+
 enum {
 	C65_REGISTER_ACCUMULATOR = 0, /* Accumulator register (A) */
 	C65_REGISTER_INDEX_X, /* Index-x register (X) */
@@ -87,6 +137,21 @@ enum {
 
 #define C65_REGISTER_MAX C65_REGISTER_STACK_POINTER
 
+enum {
+	C65_TIMING_FAST = 0, /* Instruction-level timing */
+	C65_TIMING_EXACT, /* Cycle-exact bus timing */
+};
+
+#define C65_TIMING_MAX C65_TIMING_EXACT
+
+enum {
+	C65_WATCH_READ = 0, /* Read watch (guest reads only) */
+	C65_WATCH_WRITE, /* Write watch */
+	C65_WATCH_VALUE, /* Value-conditional watch */
+};
+
+#define C65_WATCH_MAX C65_WATCH_VALUE
+
 typedef uint8_t c65_byte_t; /* Byte type */
 typedef uint16_t c65_word_t; /* Word type */
 typedef uint32_t c65_dword_t; /* Double-word type */
@@ -121,12 +186,21 @@ typedef union {
 
 typedef c65_address_t c65_register_t; /* Register structure */
 
+ /* Condition structure */
+typedef struct {
+	c65_byte_t type; /* Condition type */
+	c65_byte_t compare; /* Condition comparison */
+	c65_word_t operand; /* Condition operand (memory address, register type or status mask) */
+	c65_dword_t value; /* Condition value */
+} __attribute__((packed)) c65_condition_t;
+
  /* Action structure */
 typedef struct {
 	int type; /* Action type */
 	c65_address_t address; /* Action address */
 
 	union {
+		c65_condition_t condition; /* Action condition */
 		c65_dword_t cycle; /* Action cycle */
 		c65_register_t data; /* Action data */
 		c65_status_t status; /* Action status */
@@ -135,12 +209,57 @@ typedef struct {
 
 typedef c65_action_t c65_event_t; /* Event structure */
 
+ /* Event entry structure */
+typedef struct {
+	c65_dword_t cycle; /* Event cycle */
+	c65_event_t event; /* Event structure */
+} c65_event_entry_t;
+
 /**
  * Event handler
  * @param event Event structure
  */
 typedef void (*c65_event_hdlr)(const c65_event_t *event);
 
+/**
+ * Region read handler
+ * @param context Region context
+ * @param address Region address
+ * @return Region value
+ */
+typedef c65_byte_t (*c65_region_read_hdlr)(void *context, c65_address_t address);
+
+/**
+ * Region write handler
+ * @param context Region context
+ * @param address Region address
+ * @param value Region value
+ */
+typedef void (*c65_region_write_hdlr)(void *context, c65_address_t address, c65_byte_t value);
+
+ /* Region structure */
+typedef struct {
+	c65_byte_t *data; /* Region data (optional) */
+	c65_region_read_hdlr read; /* Region read handler, used when data is NULL (optional) */
+	c65_region_write_hdlr write; /* Region write handler, takes priority over data (optional) */
+	void *context; /* Region handler context */
+} c65_region_t;
+
+ /* Memory view structure */
+typedef struct {
+	const c65_byte_t *zero_page; /* Zero page memory */
+	const c65_byte_t *stack; /* Stack memory */
+	const c65_byte_t *video; /* Video memory */
+	const c65_byte_t *high; /* High memory (bank 0) */
+	c65_dword_t *dirty; /* Dirty page bitmap, one bit per page, set by the emulator and cleared by the host */
+} c65_memory_view_t;
+
+ /* Watch structure */
+typedef struct {
+	int type; /* Watch type mask, one bit per C65_WATCH_* type */
+	c65_byte_t value; /* Watch value, used with C65_WATCH_VALUE */
+} c65_watch_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif // __cplusplus
@@ -158,10 +277,19 @@ extern "C" {
 int c65_action(const c65_action_t *request, c65_action_t *response);
 
 /**
- * Cleanup emulator
+ * Cleanup emulator, which discards queued event ring entries (stop draining first)
  */
 void c65_cleanup(void);
 
+/**
+ * Drain emulator event ring, safe to call from a thread other than the emulator thread
+ * @param entry Event entry array
+ * @param count Event entry array length, updated with the number of entries drained
+ * @param overflow Events dropped since the last drain (optional)
+ * @return EXIT_SUCCESS on success
+ */
+int c65_event_drain(c65_event_entry_t *entry, c65_dword_t *count, c65_dword_t *overflow);
+
 /**
  * Register emulator event handler
  * @param type Event type
@@ -170,6 +298,13 @@ void c65_cleanup(void);
  */
 int c65_event_handler(int type, c65_event_hdlr handler);
 
+/**
+ * Enable emulator event ring, which replaces event handler callbacks while enabled (queued entries survive toggling)
+ * @param enable Enable state
+ * @return EXIT_SUCCESS on success
+ */
+int c65_event_ring(int enable);
+
 /**
  * Interrupt emulator
  * @param type Interrupt type
@@ -186,6 +321,41 @@ int c65_interrupt(int type);
  */
 int c65_load(const c65_byte_t *data, c65_dword_t length, c65_address_t base);
 
+/**
+ * Load emulator memory bank
+ * @param data Data pointer
+ * @param length Data length
+ * @param base Base address
+ * @param bank Memory bank (0 for base memory, otherwise requires banking and a range within the banked window)
+ * @return EXIT_SUCCESS on success
+ */
+int c65_load_bank(const c65_byte_t *data, c65_dword_t length, c65_address_t base, c65_byte_t bank);
+
+/**
+ * Retrieve emulator memory view, valid until cleanup
+ * @param view Memory view structure
+ * @return EXIT_SUCCESS on success
+ */
+int c65_memory_view(c65_memory_view_t *view);
+
+/**
+ * Read emulator memory block (pages with only a region read handler read as zero)
+ * @param data Data pointer
+ * @param length Data length
+ * @param base Base address
+ * @return EXIT_SUCCESS on success
+ */
+int c65_read_block(c65_byte_t *data, c65_dword_t length, c65_address_t base);
+
+/**
+ * Register emulator memory region
+ * @param base Base address (page aligned)
+ * @param length Region length (multiple of page length)
+ * @param region Region structure, or NULL to restore the default mapping
+ * @return EXIT_SUCCESS on success
+ */
+int c65_region(c65_address_t base, c65_dword_t length, const c65_region_t *region);
+
 /**
  * Reset emulator
  * @return EXIT_SUCCESS on success
@@ -212,6 +382,33 @@ int c65_step(void);
  */
 int c65_unload(c65_address_t base, c65_dword_t length);
 
+/**
+ * Unload emulator memory bank
+ * @param base Base address
+ * @param length Byte length
+ * @param bank Memory bank (0 for base memory, otherwise requires banking and a range within the banked window)
+ * @return EXIT_SUCCESS on success
+ */
+int c65_unload_bank(c65_address_t base, c65_dword_t length, c65_byte_t bank);
+
+/**
+ * Register emulator memory watch
+ * @param base Base address
+ * @param length Watch length
+ * @param watch Watch structure, or NULL to clear watches in range
+ * @return EXIT_SUCCESS on success
+ */
+int c65_watch(c65_address_t base, c65_dword_t length, const c65_watch_t *watch);
+
+/**
+ * Write emulator memory block
+ * @param data Data pointer
+ * @param length Data length
+ * @param base Base address
+ * @return EXIT_SUCCESS on success
+ */
+int c65_write_block(const c65_byte_t *data, c65_dword_t length, c65_address_t base);
+
 /**********************************************
  * MISC.
  **********************************************/
@@ -20,6 +20,9 @@
 #define C65_COMMON_H_
 
 #include <SDL2/SDL.h>
+#include <array>
+#include <atomic>
+#include <bitset>
 #include <cstdarg>
 #include <cstdint>
 #include <cstdlib>
@@ -33,6 +36,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #ifndef __in
@@ -56,8 +60,12 @@
 
 #include "./common/action.h"
 #include "./common/address.h"
+#include "./common/attribute.h"
 #include "./common/bit.h"
 #include "./common/color.h"
+#include "./common/compare.h"
+#include "./common/condition.h"
+#include "./common/engine.h"
 #include "./common/event.h"
 #include "./common/exception.h"
 #include "./common/flag.h"
@@ -69,7 +77,9 @@
 #include "./common/register.h"
 #include "./common/stack.h"
 #include "./common/string.h"
+#include "./common/timing.h"
 #include "./common/trace.h"
 #include "./common/version.h"
+#include "./common/watch.h"
 
 #endif // C65_COMMON_H_
@@ -21,12 +21,17 @@
 
 static const std::string ACTION_STR[] = {
 	"Breakpoint-Clear", // C65_ACTION_BREAKPOINT_CLEAR
+	"Breakpoint-Condition", // C65_ACTION_BREAKPOINT_CONDITION
 	"Breakpoint-Set", // C65_ACTION_BREAKPOINT_SET
 	"Cycle", // C65_ACTION_CYCLE
 	"Interrupt-Pending", // C65_ACTION_INTERRUPT_PENDING
+	"Read-Attribute", // C65_ACTION_READ_ATTRIBUTE
+	"Read-Banking", // C65_ACTION_READ_BANKING
 	"Read-Byte", // C65_ACTION_READ_BYTE
+	"Read-Engine", // C65_ACTION_READ_ENGINE
 	"Read-Register", // C65_ACTION_READ_REGISTER
 	"Read-Status", // C65_ACTION_READ_STATUS
+	"Read-Timing", // C65_ACTION_READ_TIMING
 	"Read-Word", // C65_ACTION_READ_WORD
 	"Stack-Overflow", // C65_ACTION_STACK_OVERFLOW
 	"Stack-Underflow", // C65_ACTION_STACK_UNDERFLOW
@@ -35,9 +40,13 @@ static const std::string ACTION_STR[] = {
 	"Watch-Clear", // C65_ACTION_WATCH_CLEAR
 	"Watch-Set", // C65_ACTION_WATCH_SET
 	"Window-Show", // C65_ACTION_WINDOW_SHOW
+	"Write-Attribute", // C65_ACTION_WRITE_ATTRIBUTE
+	"Write-Banking", // C65_ACTION_WRITE_BANKING
 	"Write-Byte", // C65_ACTION_WRITE_BYTE
+	"Write-Engine", // C65_ACTION_WRITE_ENGINE
 	"Write-Register", // C65_ACTION_WRITE_REGISTER
 	"Write-Status", // C65_ACTION_WRITE_STATUS
+	"Write-Timing", // C65_ACTION_WRITE_TIMING
 	"Write-Word", // C65_ACTION_WRITE_WORD
 	};
 
@@ -21,6 +21,10 @@
 
 #define ADDRESS_KEY 0x00ff
 
+#define ADDRESS_MEMORY_BANK 0x00fd
+#define ADDRESS_MEMORY_BANK_BEGIN 0x8000
+#define ADDRESS_MEMORY_BANK_END 0xbfff
+
 #define ADDRESS_MEMORY_HIGH_BEGIN 0x0600
 #define ADDRESS_MEMORY_HIGH_END 0xfff9
 #define ADDRESS_MEMORY_STACK_BEGIN 0x0100
@@ -28,6 +32,9 @@
 #define ADDRESS_MEMORY_ZERO_PAGE_BEGIN 0x0000
 #define ADDRESS_MEMORY_ZERO_PAGE_END 0x00fd
 
+#define ADDRESS_PAGE_COUNT 0x0100
+#define ADDRESS_PAGE_LENGTH 0x0100
+
 #define ADDRESS_PROCESSOR_MASKABLE_BEGIN 0xfffe
 #define ADDRESS_PROCESSOR_MASKABLE_END 0xffff
 #define ADDRESS_PROCESSOR_NON_MASKABLE_BEGIN 0xfffa
@@ -43,4 +50,9 @@
 #define ADDRESS_LENGTH(_BEGIN_, _END_) \
 	(((_END_) + 1) - (_BEGIN_))
 
+#define ADDRESS_PAGE(_ADDRESS_) \
+	(((_ADDRESS_) >> 8) & UINT8_MAX)
+
+typedef std::bitset<UINT16_MAX + 1> address_set_t;
+
 #endif // C65_COMMON_ADDRESS_H_
@@ -0,0 +1,35 @@
+/**
+ * C65
+ * Copyright (C) 2019 David Jolly
+ *
+ * C65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef C65_COMMON_ATTRIBUTE_H_
+#define C65_COMMON_ATTRIBUTE_H_
+
+static const std::string ATTRIBUTE_STR[] = {
+	"Read-Only", // C65_ATTRIBUTE_READ_ONLY
+	"No-Execute", // C65_ATTRIBUTE_NO_EXECUTE
+	"MMIO", // C65_ATTRIBUTE_MMIO
+	};
+
+#define ATTRIBUTE_MASK \
+	(MASK(C65_ATTRIBUTE_MAX + 1) - 1)
+
+#define ATTRIBUTE_STRING(_TYPE_) \
+	(((_TYPE_) > C65_ATTRIBUTE_MAX) ? STRING_UNKNOWN : \
+		STRING(ATTRIBUTE_STR[_TYPE_]))
+
+#endif // C65_COMMON_ATTRIBUTE_H_
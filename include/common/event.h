@@ -24,6 +24,7 @@ static const std::string EVENT_STR[] = {
 	"Illegal-Instruction", // C65_EVENT_ILLEGAL_INSTRUCTION
 	"Interrupt-Entry", // C65_EVENT_INTERRUPT_ENTRY
 	"Interrupt-Exit", // C65_EVENT_INTERRUPT_EXIT
+	"Protection-Fault", // C65_EVENT_PROTECTION_FAULT
 	"Stack-Overflow", // C65_EVENT_STACK_OVERFLOW
 	"Stack-Underflow", // C65_EVENT_STACK_UNDERFLOW
 	"Stop-Entry", // C65_EVENT_STOP_ENTRY
@@ -33,8 +34,12 @@ static const std::string EVENT_STR[] = {
 	"Wait-Entry", // C65_EVENT_WAIT_ENTRY
 	"Wait-Exit", // C65_EVENT_WAIT_EXIT
 	"Watch", // C65_EVENT_WATCH
+	"Watch-Read", // C65_EVENT_WATCH_READ
 	};
 
+#define EVENT_MASK \
+	(MASK(C65_EVENT_MAX + 1) - 1)
+
 #define EVENT_STRING(_TYPE_) \
 	(((_TYPE_) > C65_EVENT_MAX) ? STRING_UNKNOWN : \
 		STRING(EVENT_STR[_TYPE_]))
@@ -265,7 +265,7 @@ enum {
 
 #define INSTRUCTION_MODE_MAX INSTRUCTION_MODE_ILLEGAL_NOP_5
 
-static const uint8_t INSTRUCTION_MODE_CYC[] = {
+static constexpr uint8_t INSTRUCTION_MODE_CYC[] = {
 	4, // INSTRUCTION_MODE_ABSOLUTE
 	6, // INSTRUCTION_MODE_ABSOLUTE_INDEX_INDIRECT
 	4, // INSTRUCTION_MODE_ABSOLUTE_INDEX_X
@@ -299,7 +299,7 @@ static const uint8_t INSTRUCTION_MODE_CYC[] = {
 	(((_TYPE_) > INSTRUCTION_MODE_MAX) ? INSTRUCTION_MODE_CYC[INSTRUCTION_MODE_IMPLIED] : \
 		INSTRUCTION_MODE_CYC[_TYPE_])
 
-static const uint8_t INSTRUCTION_MODE_LEN[] = {
+static constexpr uint8_t INSTRUCTION_MODE_LEN[] = {
 	INSTRUCTION_LENGTH_WORD, // INSTRUCTION_MODE_ABSOLUTE
 	INSTRUCTION_LENGTH_WORD, // INSTRUCTION_MODE_ABSOLUTE_INDEX_INDIRECT
 	INSTRUCTION_LENGTH_WORD, // INSTRUCTION_MODE_ABSOLUTE_INDEX_X
@@ -696,7 +696,7 @@ typedef struct {
 	uint8_t cycle;
 } instruction_t;
 
-static const instruction_t CMD[] = {
+static constexpr instruction_t CMD[] = {
 
 	// 0x00
 	{ INSTRUCTION_BRK, INSTRUCTION_MODE_INTERRUPT, INSTRUCTION_MODE_LENGTH(INSTRUCTION_MODE_INTERRUPT), INSTRUCTION_MODE_CYCLE(INSTRUCTION_MODE_INTERRUPT) }, // brk 0
@@ -1020,7 +1020,13 @@ static const instruction_t CMD[] = {
 	};
 
 #define INSTRUCTION(_TYPE_) \
-	(((_TYPE_) > UINT8_MAX) ? CMD[INSTRUCTION_TYPE_NOP_IMPLIED] : \
-		CMD[_TYPE_])
+	CMD[(uint8_t)(_TYPE_)]
+
+template <uint8_t OPCODE> struct instruction_traits {
+	static constexpr int type = CMD[OPCODE].type;
+	static constexpr int mode = CMD[OPCODE].mode;
+	static constexpr uint8_t length = CMD[OPCODE].length;
+	static constexpr uint8_t cycle = CMD[OPCODE].cycle;
+};
 
 #endif // C65_COMMON_INSTRUCTION_H_
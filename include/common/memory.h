@@ -19,6 +19,9 @@
 #ifndef C65_COMMON_MEMORY_H_
 #define C65_COMMON_MEMORY_H_
 
+#define MEMORY_BANK_COUNT UINT8_MAX
+#define MEMORY_BANK_LENGTH ADDRESS_LENGTH(ADDRESS_MEMORY_BANK_BEGIN, ADDRESS_MEMORY_BANK_END)
+
 #define MEMORY_FILL 0xea
 #define MEMORY_ZERO 0x00
 
@@ -0,0 +1,37 @@
+/**
+ * C65
+ * Copyright (C) 2019 David Jolly
+ *
+ * C65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef C65_COMMON_WATCH_H_
+#define C65_COMMON_WATCH_H_
+
+static const std::string WATCH_STR[] = {
+	"Read", // C65_WATCH_READ
+	"Write", // C65_WATCH_WRITE
+	"Value", // C65_WATCH_VALUE
+	};
+
+#define WATCH_MASK \
+	(MASK(C65_WATCH_MAX + 1) - 1)
+
+#define WATCH_VALUE_ANY -1
+
+#define WATCH_STRING(_TYPE_) \
+	(((_TYPE_) > C65_WATCH_MAX) ? STRING_UNKNOWN : \
+		STRING(WATCH_STR[_TYPE_]))
+
+#endif // C65_COMMON_WATCH_H_
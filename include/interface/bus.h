@@ -30,18 +30,49 @@ namespace c65 {
 
 			public:
 
+				uint8_t attribute(
+					__in c65_address_t address
+					) const
+				{
+					uint8_t result;
+
+					TRACE_ENTRY_FORMAT("Address=%u(%04x)", address.word, address.word);
+
+					result = (m_page ? m_page[address.high].attribute : 0);
+
+					TRACE_EXIT_FORMAT("Result=%u(%02x)", result, result);
+					return result;
+				}
+
+				bool cacheable(
+					__in c65_address_t address
+					) const
+				{
+					bool result;
+
+					TRACE_ENTRY_FORMAT("Address=%u(%04x)", address.word, address.word);
+
+					// pages without a direct read pointer are read through on_read, which may have side effects
+					result = (!m_page || m_page[address.high].read);
+
+					TRACE_EXIT_FORMAT("Result=%x", result);
+					return result;
+				}
+
 				void notify(
 					__in int type,
 					__in c65_address_t address
 					) const
 				{
-					c65_event_t event = {};
-
 					TRACE_ENTRY_FORMAT("Type=%i(%s), Address=%u(%04x)", type, EVENT_STRING(type), address.word, address.word);
 
-					event.type = type;
-					event.address = address;
-					on_notify(event);
+					if(m_subscription & MASK(type)) {
+						c65_event_t event = {};
+
+						event.type = type;
+						event.address = address;
+						on_notify(event);
+					}
 
 					TRACE_EXIT();
 				}
@@ -52,15 +83,17 @@ namespace c65 {
 					__in c65_word_t value
 					) const
 				{
-					c65_event_t event = {};
-
 					TRACE_ENTRY_FORMAT("Type=%i(%s), Address=%u(%04x), Value=%u(%04x)", type, EVENT_STRING(type),
 						address.word, address.word, value, value);
 
-					event.type = type;
-					event.address = address;
-					event.data.word = value;
-					on_notify(event);
+					if(m_subscription & MASK(type)) {
+						c65_event_t event = {};
+
+						event.type = type;
+						event.address = address;
+						event.data.word = value;
+						on_notify(event);
+					}
 
 					TRACE_EXIT();
 				}
@@ -73,12 +106,37 @@ namespace c65 {
 
 					TRACE_ENTRY_FORMAT("Address=%u(%04x)", address.word, address.word);
 
-					result = on_read(address);
+					if(m_page && m_page[address.high].read) {
+						result = m_page[address.high].read[address.low];
+					} else {
+						result = on_read(address);
+					}
 
 					TRACE_EXIT_FORMAT("Result=%u(%02x)", result, result);
 					return result;
 				}
 
+				bool subscribed(
+					__in int type
+					) const
+				{
+					bool result;
+
+					TRACE_ENTRY_FORMAT("Type=%i(%s)", type, EVENT_STRING(type));
+
+					result = (m_subscription & MASK(type));
+
+					TRACE_EXIT_FORMAT("Result=%x", result);
+					return result;
+				}
+
+				uint32_t subscription(void) const
+				{
+					TRACE_ENTRY();
+					TRACE_EXIT_FORMAT("Result=%u(%08x)", m_subscription, m_subscription);
+					return m_subscription;
+				}
+
 				void write(
 					__in c65_address_t address,
 					__in c65_byte_t value
@@ -93,6 +151,20 @@ namespace c65 {
 
 			protected:
 
+				typedef struct {
+					const c65_byte_t *read;
+					c65_byte_t *write;
+					uint8_t attribute;
+				} page_t;
+
+				bus(void) :
+					m_page(nullptr),
+					m_subscription(EVENT_MASK)
+				{
+					TRACE_ENTRY();
+					TRACE_EXIT();
+				}
+
 				virtual void on_notify(
 					__in const c65_event_t &event
 					) const = 0;
@@ -105,6 +177,10 @@ namespace c65 {
 					__in c65_address_t address,
 					__in c65_byte_t value
 					) = 0;
+
+				const page_t *m_page;
+
+				uint32_t m_subscription;
 		};
 	}
 }
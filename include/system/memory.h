@@ -35,6 +35,16 @@ namespace c65 {
 
 				~memory(void);
 
+				c65_byte_t *data(
+					__in c65_address_t address
+					);
+
+				c65_byte_t read_bank(void) const;
+
+				void write_bank(
+					__in c65_byte_t bank
+					);
+
 			protected:
 
 				friend class c65::interface::singleton<c65::system::memory>;
@@ -66,6 +76,10 @@ namespace c65 {
 					__in c65_byte_t value
 					) override;
 
+				c65_byte_t m_bank;
+
+				c65::type::buffer m_extended;
+
 				c65::type::buffer m_high;
 
 				c65::type::buffer m_stack;
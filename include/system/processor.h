@@ -34,22 +34,40 @@ namespace c65 {
 
 				~processor(void);
 
+				uint32_t elapsed(void) const;
+
+				void flush(void);
+
 				void interrupt(
 					__in int type
 					);
 
 				bool interrupt_pending(void) const;
 
+				void invalidate(
+					__in c65_address_t address
+					);
+
+				int read_engine(void) const;
+
 				c65_register_t read_register(
 					__in int type
 					) const;
 
 				c65_status_t read_status(void) const;
 
+				int read_timing(void) const;
+
 				void reset(
 					__in c65::interface::bus &bus
 					);
 
+				uint32_t run(
+					__in c65::interface::bus &bus,
+					__in uint32_t cycle,
+					__in const address_set_t *breakpoint
+					);
+
 				bool stack_overflow(void) const;
 
 				bool stack_underflow(void) const;
@@ -58,10 +76,18 @@ namespace c65 {
 					__in c65::interface::bus &bus
 					);
 
+				uint32_t step_block(
+					__in c65::interface::bus &bus
+					);
+
 				bool stopped(void) const;
 
 				bool waiting(void) const;
 
+				void write_engine(
+					__in int type
+					);
+
 				void write_register(
 					__in int type,
 					__in c65_register_t value
@@ -71,10 +97,112 @@ namespace c65 {
 					__in c65_status_t value
 					);
 
+				void write_timing(
+					__in int type
+					);
+
 			protected:
 
 				friend class c65::interface::singleton<c65::system::processor>;
 
+				typedef uint8_t (processor::*handler_t)(
+					__in c65::interface::bus &bus,
+					__in const instruction_t &instruction,
+					__in c65_word_t operand
+					);
+
+				typedef struct {
+					handler_t handler;
+					uint32_t generation;
+					c65_word_t operand;
+					uint8_t opcode;
+				} decode_t;
+
+				typedef struct {
+					uint32_t generation;
+					std::vector<decode_t> entry;
+				} block_t;
+
+				typedef struct {
+					c65_word_t program_counter;
+					c65_byte_t accumulator;
+					c65_byte_t index_x;
+					c65_byte_t index_y;
+					c65_byte_t stack_pointer;
+					c65_byte_t status;
+					int interrupt;
+					uint32_t write;
+				} idle_t;
+
+				static const std::vector<c65_word_t> DECIMAL;
+
+				class cycle_bus :
+						public c65::interface::bus {
+
+					public:
+
+						explicit cycle_bus(
+							__in c65::interface::bus &bus
+							);
+
+						~cycle_bus(void);
+
+						uint32_t access(void) const;
+
+						void idle(
+							__in c65_address_t address,
+							__in uint8_t count = 1
+							) const;
+
+						void index(
+							__in c65_address_t address,
+							__in c65_byte_t index,
+							__in uint32_t access,
+							__in bool always
+							);
+
+						void modify(void);
+
+					protected:
+
+						void on_notify(
+							__in const c65_event_t &event
+							) const override;
+
+						c65_byte_t on_read(
+							__in c65_address_t address
+							) const override;
+
+						void on_write(
+							__in c65_address_t address,
+							__in c65_byte_t value
+							) override;
+
+						void schedule(
+							__in c65_address_t address
+							) const;
+
+						mutable uint32_t m_access;
+
+						bool m_always;
+
+						c65::interface::bus &m_bus;
+
+						uint32_t m_data;
+
+						c65_address_t m_idle;
+
+						c65_byte_t m_index;
+
+						bool m_indexed;
+
+						bool m_modify;
+
+						mutable uint32_t m_request;
+				};
+
+				static const std::array<std::array<handler_t, UINT8_MAX + 1>, C65_TIMING_MAX + 1> HANDLER;
+
 				processor(void);
 
 				processor(
@@ -89,10 +217,21 @@ namespace c65 {
 					__in uint8_t value
 					);
 
-				c65_address_t effective_address(
+				void add_decimal(
+					__in uint8_t value,
+					__in bool subtract
+					);
+
+				static std::vector<c65_word_t> decimal_table(void);
+
+				const decode_t &decode(
+					__in c65::interface::bus &bus,
+					__in c65_address_t address
+					);
+
+				template <int MODE> c65_address_t effective_address(
 					__in c65::interface::bus &bus,
 					__in c65_word_t indirect,
-					__in int mode,
 					__inout uint8_t &cycle
 					);
 
@@ -100,108 +239,130 @@ namespace c65 {
 					__in c65::interface::bus &bus
 					);
 
-				uint8_t execute_add(
+				uint32_t execute_block(
+					__in c65::interface::bus &bus
+					);
+
+				template <int TYPE, int MODE> uint8_t execute_add(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_and(
+				template <int TYPE, int MODE> uint8_t execute_and(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_bit(
+				template <int TYPE, int MODE> uint8_t execute_bit(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_branch(
+				template <int TYPE, int MODE> uint8_t execute_branch(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_branch_bit(
+				template <int TYPE, int MODE> uint8_t execute_branch_bit(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_break(
+				template <int TYPE, int MODE> uint8_t execute_break(
 					__in c65::interface::bus &bus,
-					__in const instruction_t &instruction
+					__in const instruction_t &instruction,
+					__in c65_word_t operand
 					);
 
-				uint8_t execute_clear(
-					__in const instruction_t &instruction
+				template <int TYPE, int MODE> uint8_t execute_clear(
+					__in c65::interface::bus &bus,
+					__in const instruction_t &instruction,
+					__in c65_word_t operand
+					);
+
+				template <int TYPE, int MODE> uint8_t execute_compare(
+					__in c65::interface::bus &bus,
+					__in const instruction_t &instruction,
+					__in c65_word_t operand
 					);
 
-				uint8_t execute_compare(
+				template <int TYPE, int MODE> uint8_t execute_compare_index_x(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_compare_index_x(
+				template <int TYPE, int MODE> uint8_t execute_compare_index_y(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_compare_index_y(
+				template <int TYPE, int MODE> uint8_t execute_decrement(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_decrement(
+				template <int TYPE, int MODE> uint8_t execute_decrement_index(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_decrement_index(
+				template <uint8_t OPCODE> uint8_t execute_exact(
+					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction
 					);
 
-				uint8_t execute_increment(
+				uint8_t execute_fault(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_increment_index(
-					__in const instruction_t &instruction
+				template <int TYPE, int MODE> uint8_t execute_increment(
+					__in c65::interface::bus &bus,
+					__in const instruction_t &instruction,
+					__in c65_word_t operand
+					);
+
+				template <int TYPE, int MODE> uint8_t execute_increment_index(
+					__in c65::interface::bus &bus,
+					__in const instruction_t &instruction,
+					__in c65_word_t operand
 					);
 
-				uint8_t execute_jump(
+				template <int TYPE, int MODE> uint8_t execute_jump(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_jump_subroutine(
+				template <int TYPE, int MODE> uint8_t execute_jump_subroutine(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_load_accumulator(
+				template <int TYPE, int MODE> uint8_t execute_load_accumulator(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_load_index_x(
+				template <int TYPE, int MODE> uint8_t execute_load_index_x(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_load_index_y(
+				template <int TYPE, int MODE> uint8_t execute_load_index_y(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
@@ -209,138 +370,166 @@ namespace c65 {
 
 				uint8_t execute_no_operation(void);
 
-				uint8_t execute_no_operation(
-					__in const instruction_t &instruction
+				template <uint8_t OPCODE> uint8_t execute_no_operation(
+					__in c65::interface::bus &bus,
+					__in const instruction_t &instruction,
+					__in c65_word_t operand
 					);
 
-				uint8_t execute_or(
+				template <uint8_t OPCODE, int TIMING> uint8_t execute_opcode(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_pull(
+				template <int TYPE, int MODE> uint8_t execute_or(
 					__in c65::interface::bus &bus,
-					__in const instruction_t &instruction
+					__in const instruction_t &instruction,
+					__in c65_word_t operand
 					);
 
-				uint8_t execute_push(
+				template <int TYPE, int MODE> uint8_t execute_pull(
 					__in c65::interface::bus &bus,
-					__in const instruction_t &instruction
+					__in const instruction_t &instruction,
+					__in c65_word_t operand
 					);
 
-				uint8_t execute_reset_bit(
+				template <int TYPE, int MODE> uint8_t execute_push(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_return_interrupt(
+				template <int TYPE, int MODE> uint8_t execute_reset_bit(
 					__in c65::interface::bus &bus,
-					__in const instruction_t &instruction
+					__in const instruction_t &instruction,
+					__in c65_word_t operand
 					);
 
-				uint8_t execute_return_subroutine(
+				template <int TYPE, int MODE> uint8_t execute_return_interrupt(
 					__in c65::interface::bus &bus,
-					__in const instruction_t &instruction
+					__in const instruction_t &instruction,
+					__in c65_word_t operand
 					);
 
-				uint8_t execute_rotate_left(
+				template <int TYPE, int MODE> uint8_t execute_return_subroutine(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_rotate_right(
+				template <int TYPE, int MODE> uint8_t execute_rotate_left(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_set(
-					__in const instruction_t &instruction
+				template <int TYPE, int MODE> uint8_t execute_rotate_right(
+					__in c65::interface::bus &bus,
+					__in const instruction_t &instruction,
+					__in c65_word_t operand
 					);
 
-				uint8_t execute_set_bit(
+				template <int TYPE, int MODE> uint8_t execute_set(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_shift_left(
+				template <int TYPE, int MODE> uint8_t execute_set_bit(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_shift_right(
+				template <int TYPE, int MODE> uint8_t execute_shift_left(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_stop(
-					__in const c65::interface::bus &bus,
-					__in const instruction_t &instruction
+				template <int TYPE, int MODE> uint8_t execute_shift_right(
+					__in c65::interface::bus &bus,
+					__in const instruction_t &instruction,
+					__in c65_word_t operand
 					);
 
-				uint8_t execute_store_accumulator(
+				template <int TYPE, int MODE> uint8_t execute_stop(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_store_index_x(
+				template <int TYPE, int MODE> uint8_t execute_store_accumulator(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_store_index_y(
+				template <int TYPE, int MODE> uint8_t execute_store_index_x(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_store_zero(
+				template <int TYPE, int MODE> uint8_t execute_store_index_y(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_subtract(
+				template <int TYPE, int MODE> uint8_t execute_store_zero(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_test_reset_bit(
+				template <int TYPE, int MODE> uint8_t execute_subtract(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_test_set_bit(
+				template <int TYPE, int MODE> uint8_t execute_test_reset_bit(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
-				uint8_t execute_transfer(
-					__in const instruction_t &instruction
+				template <int TYPE, int MODE> uint8_t execute_test_set_bit(
+					__in c65::interface::bus &bus,
+					__in const instruction_t &instruction,
+					__in c65_word_t operand
 					);
 
-				uint8_t execute_wait(
-					__in const c65::interface::bus &bus,
-					__in const instruction_t &instruction
+				template <int TYPE, int MODE> uint8_t execute_transfer(
+					__in c65::interface::bus &bus,
+					__in const instruction_t &instruction,
+					__in c65_word_t operand
 					);
 
-				uint8_t execute_xor(
+				template <int TYPE, int MODE> uint8_t execute_wait(
 					__in c65::interface::bus &bus,
 					__in const instruction_t &instruction,
 					__in c65_word_t operand
 					);
 
+				template <int TYPE, int MODE> uint8_t execute_xor(
+					__in c65::interface::bus &bus,
+					__in const instruction_t &instruction,
+					__in c65_word_t operand
+					);
+
+				template <uint8_t OPCODE> static constexpr handler_t handler(void);
+
+				template <int TIMING, std::size_t... OPCODE> static constexpr std::array<handler_t, sizeof...(OPCODE)> handler_table(
+					__in std::index_sequence<OPCODE...> opcode
+					);
+
+				bool idle(
+					__inout idle_t &state
+					);
+
 				void on_initialize(void) override;
 
 				void on_notify(
@@ -396,6 +585,12 @@ namespace c65 {
 					__in bool breakpoint
 					);
 
+				c65_status_t status(void) const;
+
+				const block_t &translate(
+					__in c65::interface::bus &bus
+					);
+
 				void write_byte(
 					__in c65::interface::bus &bus,
 					__in c65_address_t address,
@@ -410,6 +605,18 @@ namespace c65 {
 
 				c65_register_t m_accumulator;
 
+				std::vector<block_t> m_block;
+
+				std::vector<uint32_t> m_block_cover;
+
+				std::vector<decode_t> m_decode;
+
+				uint32_t m_elapsed;
+
+				int m_engine;
+
+				uint32_t m_generation;
+
 				c65_register_t m_index_x;
 
 				c65_register_t m_index_y;
@@ -424,6 +631,8 @@ namespace c65 {
 
 				c65_address_t m_reset;
 
+				c65_word_t m_result;
+
 				int m_stack;
 
 				c65_register_t m_stack_pointer;
@@ -432,7 +641,11 @@ namespace c65 {
 
 				bool m_stop;
 
+				int m_timing;
+
 				bool m_wait;
+
+				uint32_t m_write;
 		};
 	}
 }
@@ -36,10 +36,26 @@ namespace c65 {
 
 				void clear(void);
 
+				const c65_byte_t *data(
+					__in c65_address_t address
+					) const;
+
+				void fill(
+					__in c65_address_t base,
+					__in c65_dword_t length,
+					__in c65_byte_t value
+					);
+
 				void frame_rate(
 					__in float rate
 					);
 
+				void load(
+					__in const c65_byte_t *data,
+					__in c65_dword_t length,
+					__in c65_address_t base
+					);
+
 				void render(void);
 
 				void show(
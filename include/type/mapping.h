@@ -0,0 +1,71 @@
+/**
+ * C65
+ * Copyright (C) 2019 David Jolly
+ *
+ * C65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef C65_TYPE_MAPPING_H_
+#define C65_TYPE_MAPPING_H_
+
+#include "./buffer.h"
+
+namespace c65 {
+
+	namespace type {
+
+		// read-only view of a file, mapped on Linux and loaded into a buffer elsewhere; the mapping is private, but
+		// truncating the file while it is mapped raises SIGBUS on any access past the new end
+		class mapping {
+
+			public:
+
+				mapping(void);
+
+				virtual ~mapping(void);
+
+				const c65_byte_t *data(void) const;
+
+				bool empty(void) const;
+
+				void map(
+					__in const std::string &path
+					);
+
+				bool mapped(void) const;
+
+				size_t size(void) const;
+
+				void unmap(void);
+
+			protected:
+
+				mapping(
+					__in const mapping &other
+					) = delete;
+
+				mapping &operator=(
+					__in const mapping &other
+					) = delete;
+
+				c65::type::buffer m_buffer;
+
+				const c65_byte_t *m_data;
+
+				size_t m_size;
+		};
+	}
+}
+
+#endif // C65_TYPE_MAPPING_H_
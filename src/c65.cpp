@@ -65,6 +65,9 @@ namespace c65 {
 						case C65_ACTION_BREAKPOINT_CLEAR:
 							result = action_breakpoint_clear(request, response);
 							break;
+						case C65_ACTION_BREAKPOINT_CONDITION:
+							result = action_breakpoint_condition(request, response);
+							break;
 						case C65_ACTION_BREAKPOINT_SET:
 							result = action_breakpoint_set(request, response);
 							break;
@@ -74,15 +77,27 @@ namespace c65 {
 						case C65_ACTION_INTERRUPT_PENDING:
 							result = action_interrupt_pending(request, response);
 							break;
+						case C65_ACTION_READ_ATTRIBUTE:
+							result = action_read_attribute(request, response);
+							break;
+						case C65_ACTION_READ_BANKING:
+							result = action_read_banking(request, response);
+							break;
 						case C65_ACTION_READ_BYTE:
 							result = action_read_byte(request, response);
 							break;
+						case C65_ACTION_READ_ENGINE:
+							result = action_read_engine(request, response);
+							break;
 						case C65_ACTION_READ_REGISTER:
 							result = action_read_register(request, response);
 							break;
 						case C65_ACTION_READ_STATUS:
 							result = action_read_status(request, response);
 							break;
+						case C65_ACTION_READ_TIMING:
+							result = action_read_timing(request, response);
+							break;
 						case C65_ACTION_READ_WORD:
 							result = action_read_word(request, response);
 							break;
@@ -107,15 +122,27 @@ namespace c65 {
 						case C65_ACTION_WINDOW_SHOW:
 							result = action_window_show(request, response);
 							break;
+						case C65_ACTION_WRITE_ATTRIBUTE:
+							result = action_write_attribute(request, response);
+							break;
+						case C65_ACTION_WRITE_BANKING:
+							result = action_write_banking(request, response);
+							break;
 						case C65_ACTION_WRITE_BYTE:
 							result = action_write_byte(request, response);
 							break;
+						case C65_ACTION_WRITE_ENGINE:
+							result = action_write_engine(request, response);
+							break;
 						case C65_ACTION_WRITE_REGISTER:
 							result = action_write_register(request, response);
 							break;
 						case C65_ACTION_WRITE_STATUS:
 							result = action_write_status(request, response);
 							break;
+						case C65_ACTION_WRITE_TIMING:
+							result = action_write_timing(request, response);
+							break;
 						case C65_ACTION_WRITE_WORD:
 							result = action_write_word(request, response);
 							break;
@@ -141,17 +168,45 @@ namespace c65 {
 				)
 			{
 				int result = EXIT_SUCCESS;
-				std::set<c65_word_t>::iterator breakpoint;
 
 				TRACE_ENTRY_FORMAT("Request=%p, Response=%p", request, response);
 
-				breakpoint = m_breakpoint.find(request->address.word);
-				if(breakpoint == m_breakpoint.end()) {
+				if(!m_breakpoint.test(request->address.word)) {
+					THROW_C65_RUNTIME_EXCEPTION_FORMAT(C65_RUNTIME_EXCEPTION_BREAKPOINT_INVALID, "%u(%04x)",
+						request->address.word, request->address.word);
+				}
+
+				m_breakpoint.reset(request->address.word);
+				m_breakpoint_condition.erase(request->address.word);
+				--m_breakpoint_count;
+
+				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+				return result;
+			}
+
+			int action_breakpoint_condition(
+				__in const c65_action_t *request,
+				__in c65_action_t *response
+				)
+			{
+				int result = EXIT_SUCCESS;
+				const c65_condition_t &condition = request->condition;
+
+				TRACE_ENTRY_FORMAT("Request=%p, Response=%p", request, response);
+
+				if(!m_breakpoint.test(request->address.word)) {
 					THROW_C65_RUNTIME_EXCEPTION_FORMAT(C65_RUNTIME_EXCEPTION_BREAKPOINT_INVALID, "%u(%04x)",
 						request->address.word, request->address.word);
 				}
 
-				m_breakpoint.erase(breakpoint);
+				if((condition.type > C65_CONDITION_MAX) || (condition.compare > C65_COMPARE_MAX)
+						|| ((condition.type == C65_CONDITION_REGISTER) && (condition.operand > C65_REGISTER_MAX))) {
+					THROW_C65_RUNTIME_EXCEPTION_FORMAT(C65_RUNTIME_EXCEPTION_CONDITION_INVALID, "%i(%s), %i(%s), %u(%04x)",
+						condition.type, CONDITION_STRING(condition.type), condition.compare, COMPARE_STRING(condition.compare),
+						condition.operand, condition.operand);
+				}
+
+				m_breakpoint_condition[request->address.word].predicate.push_back(condition);
 
 				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
 				return result;
@@ -163,17 +218,16 @@ namespace c65 {
 				)
 			{
 				int result = EXIT_SUCCESS;
-				std::set<c65_word_t>::iterator breakpoint;
 
 				TRACE_ENTRY_FORMAT("Request=%p, Response=%p", request, response);
 
-				breakpoint = m_breakpoint.find(request->address.word);
-				if(breakpoint != m_breakpoint.end()) {
+				if(m_breakpoint.test(request->address.word)) {
 					THROW_C65_RUNTIME_EXCEPTION_FORMAT(C65_RUNTIME_EXCEPTION_BREAKPOINT_INVALID, "%u(%04x)",
 						request->address.word, request->address.word);
 				}
 
-				m_breakpoint.insert(request->address.word);
+				m_breakpoint.set(request->address.word);
+				++m_breakpoint_count;
 
 				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
 				return result;
@@ -209,6 +263,36 @@ namespace c65 {
 				return result;
 			}
 
+			int action_read_attribute(
+				__in const c65_action_t *request,
+				__in c65_action_t *response
+				)
+			{
+				int result = EXIT_SUCCESS;
+
+				TRACE_ENTRY_FORMAT("Request=%p, Response=%p", request, response);
+
+				response->data.word = m_page_table.at(request->address.high).attribute;
+
+				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+				return result;
+			}
+
+			int action_read_banking(
+				__in const c65_action_t *request,
+				__in c65_action_t *response
+				)
+			{
+				int result = EXIT_SUCCESS;
+
+				TRACE_ENTRY_FORMAT("Request=%p, Response=%p", request, response);
+
+				response->data.word = m_banking;
+
+				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+				return result;
+			}
+
 			int action_read_byte(
 				__in const c65_action_t *request,
 				__in c65_action_t *response
@@ -218,7 +302,22 @@ namespace c65 {
 
 				TRACE_ENTRY_FORMAT("Request=%p, Response=%p", request, response);
 
-				response->data.word = read(request->address);
+				response->data.word = peek(request->address);
+
+				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+				return result;
+			}
+
+			int action_read_engine(
+				__in const c65_action_t *request,
+				__in c65_action_t *response
+				)
+			{
+				int result = EXIT_SUCCESS;
+
+				TRACE_ENTRY_FORMAT("Request=%p, Response=%p", request, response);
+
+				response->data.word = m_processor.read_engine();
 
 				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
 				return result;
@@ -254,6 +353,21 @@ namespace c65 {
 				return result;
 			}
 
+			int action_read_timing(
+				__in const c65_action_t *request,
+				__in c65_action_t *response
+				)
+			{
+				int result = EXIT_SUCCESS;
+
+				TRACE_ENTRY_FORMAT("Request=%p, Response=%p", request, response);
+
+				response->data.word = m_processor.read_timing();
+
+				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+				return result;
+			}
+
 			int action_read_word(
 				__in const c65_action_t *request,
 				__in c65_action_t *response
@@ -265,9 +379,9 @@ namespace c65 {
 				TRACE_ENTRY_FORMAT("Request=%p, Response=%p", request, response);
 
 				address = request->address;
-				response->data.low = read(address);
+				response->data.low = peek(address);
 				++address.word;
-				response->data.high = read(address);
+				response->data.high = peek(address);
 
 				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
 				return result;
@@ -339,17 +453,16 @@ namespace c65 {
 				)
 			{
 				int result = EXIT_SUCCESS;
-				std::set<c65_word_t>::iterator watch;
 
 				TRACE_ENTRY_FORMAT("Request=%p, Response=%p", request, response);
 
-				watch = m_watch.find(request->address.word);
-				if(watch == m_watch.end()) {
+				if(!m_watch_write.test(request->address.word)) {
 					THROW_C65_RUNTIME_EXCEPTION_FORMAT(C65_RUNTIME_EXCEPTION_WATCH_INVALID, "%u(%04x)",
 						request->address.word, request->address.word);
 				}
 
-				m_watch.erase(watch);
+				m_watch_write.reset(request->address.word);
+				watch_map(request->address.high, request->address.high);
 
 				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
 				return result;
@@ -361,17 +474,17 @@ namespace c65 {
 				)
 			{
 				int result = EXIT_SUCCESS;
-				std::set<c65_word_t>::iterator watch;
 
 				TRACE_ENTRY_FORMAT("Request=%p, Response=%p", request, response);
 
-				watch = m_watch.find(request->address.word);
-				if(watch != m_watch.end()) {
+				if(m_watch_write.test(request->address.word)) {
 					THROW_C65_RUNTIME_EXCEPTION_FORMAT(C65_RUNTIME_EXCEPTION_WATCH_INVALID, "%u(%04x)",
 						request->address.word, request->address.word);
 				}
 
-				m_watch.insert(request->address.word);
+				m_watch_value[request->address.word] = WATCH_VALUE_ANY;
+				m_watch_write.set(request->address.word);
+				watch_map(request->address.high, request->address.high);
 
 				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
 				return result;
@@ -392,6 +505,56 @@ namespace c65 {
 				return result;
 			}
 
+			int action_write_attribute(
+				__in const c65_action_t *request,
+				__in c65_action_t *response
+				)
+			{
+				int result = EXIT_SUCCESS;
+
+				TRACE_ENTRY_FORMAT("Request=%p, Response=%p", request, response);
+
+				if(request->data.word > ATTRIBUTE_MASK) {
+					THROW_C65_RUNTIME_EXCEPTION_FORMAT(C65_RUNTIME_EXCEPTION_ATTRIBUTE_INVALID, "%u(%04x)",
+						request->data.word, request->data.word);
+				}
+
+				m_page_table.at(request->address.high).attribute = request->data.word;
+				page_map(request->address.high, request->address.high);
+				m_processor.flush();
+
+				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+				return result;
+			}
+
+			int action_write_banking(
+				__in const c65_action_t *request,
+				__in c65_action_t *response
+				)
+			{
+				c65_address_t address;
+				int result = EXIT_SUCCESS;
+				bool enable = (request->data.word != 0);
+
+				TRACE_ENTRY_FORMAT("Request=%p, Response=%p", request, response);
+
+				if(m_banking != enable) {
+
+					// the base window is restored before the register reverts to zero page memory
+					if(!enable) {
+						bank_select(0);
+					}
+
+					m_banking = enable;
+					address.word = ADDRESS_MEMORY_BANK;
+					page_dirty(address.high, address.high);
+					m_processor.flush();
+				}
+
+				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+				return result;
+			}
+
 			int action_write_byte(
 				__in const c65_action_t *request,
 				__in c65_action_t *response
@@ -407,6 +570,21 @@ namespace c65 {
 				return result;
 			}
 
+			int action_write_engine(
+				__in const c65_action_t *request,
+				__in c65_action_t *response
+				)
+			{
+				int result = EXIT_SUCCESS;
+
+				TRACE_ENTRY_FORMAT("Request=%p, Response=%p", request, response);
+
+				m_processor.write_engine(request->data.word);
+
+				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+				return result;
+			}
+
 			int action_write_register(
 				__in const c65_action_t *request,
 				__in c65_action_t *response
@@ -437,6 +615,21 @@ namespace c65 {
 				return result;
 			}
 
+			int action_write_timing(
+				__in const c65_action_t *request,
+				__in c65_action_t *response
+				)
+			{
+				int result = EXIT_SUCCESS;
+
+				TRACE_ENTRY_FORMAT("Request=%p, Response=%p", request, response);
+
+				m_processor.write_timing(request->data.word);
+
+				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+				return result;
+			}
+
 			int action_write_word(
 				__in const c65_action_t *request,
 				__in c65_action_t *response
@@ -468,6 +661,50 @@ namespace c65 {
 				return result;
 			}
 
+			int event_drain(
+				__in c65_event_entry_t *entry,
+				__inout c65_dword_t *count,
+				__in_opt c65_dword_t *overflow
+				)
+			{
+				int result = EXIT_SUCCESS;
+
+				TRACE_ENTRY_FORMAT("Entry=%p, Count=%p, Overflow=%p", entry, count, overflow);
+
+				try {
+					c65_dword_t index = 0;
+					uint32_t head, tail;
+
+					if(!entry || !count) {
+						THROW_C65_RUNTIME_EXCEPTION_FORMAT(C65_RUNTIME_EXCEPTION_EVENT_INVALID,
+							"%p, %p", entry, count);
+					}
+
+					tail = m_ring_tail.load(std::memory_order_relaxed);
+					head = m_ring_head.load(std::memory_order_acquire);
+
+					for(; (index < *count) && (tail != head); ++index, ++tail) {
+						entry[index] = m_ring[tail & (C65_EVENT_RING_LENGTH - 1)];
+					}
+
+					m_ring_tail.store(tail, std::memory_order_release);
+					*count = index;
+
+					if(overflow) {
+						*overflow = m_ring_overflow.exchange(0, std::memory_order_relaxed);
+					}
+				} catch(c65::type::exception &exc) {
+					m_error = exc.to_string();
+					result = EXIT_FAILURE;
+				} catch(std::exception &exc) {
+					m_error = exc.what();
+					result = EXIT_FAILURE;
+				}
+
+				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+				return result;
+			}
+
 			int event_handler(
 				__in int type,
 				__in c65_event_hdlr handler
@@ -489,6 +726,36 @@ namespace c65 {
 					}
 
 					m_event.at(type) = handler;
+					subscription_map();
+				} catch(c65::type::exception &exc) {
+					m_error = exc.to_string();
+					result = EXIT_FAILURE;
+				} catch(std::exception &exc) {
+					m_error = exc.what();
+					result = EXIT_FAILURE;
+				}
+
+				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+				return result;
+			}
+
+			int event_ring(
+				__in bool enable
+				)
+			{
+				int result = EXIT_SUCCESS;
+
+				TRACE_ENTRY_FORMAT("Enable=%x", enable);
+
+				try {
+					TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Runtime event ring", "%x", enable);
+
+					initialize();
+
+					// the ring indices are left alone, since the consumer may still be draining, so any queued entries
+					// remain available to drain after the ring is disabled
+					m_ring_enabled = enable;
+					subscription_map();
 				} catch(c65::type::exception &exc) {
 					m_error = exc.to_string();
 					result = EXIT_FAILURE;
@@ -530,41 +797,91 @@ namespace c65 {
 			int load(
 				__in const c65_byte_t *data,
 				__in c65_dword_t length,
-				__in c65_address_t base
+				__in c65_address_t base,
+				__in c65_byte_t bank
 				)
 			{
 				int result = EXIT_SUCCESS;
 
-				TRACE_ENTRY_FORMAT("Data[%u(%08x)]=%p, Base=%u(%04x)", length, length, data, base.word, base.word);
+				TRACE_ENTRY_FORMAT("Data[%u(%08x)]=%p, Base=%u(%04x), Bank=%u(%02x)", length, length, data, base.word, base.word,
+					bank, bank);
 
 				try {
-					uint32_t index;
+					c65_byte_t previous;
+					bool changed = false;
+					uint32_t count, index = 0;
 
-					TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Runtime load request", "[%u(%08x)]%p, %u(%04x)",
-						length, length, data, base.word, base.word);
+					TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Runtime load request", "[%u(%08x)]%p, %u(%04x), %u(%02x)",
+						length, length, data, base.word, base.word, bank, bank);
 
 					initialize();
+					bank_check(base, length, bank);
+					previous = bank_select(bank);
 
-					for(index = 0; index < length; ++index) {
-						c65_address_t address;
+					try {
 
-						address.word = ((index + base.word) & UINT16_MAX);
-						switch(address.word) {
-							case ADDRESS_MEMORY_HIGH_BEGIN ... ADDRESS_MEMORY_HIGH_END:
-							case ADDRESS_MEMORY_STACK_BEGIN ... ADDRESS_MEMORY_STACK_END:
-							case ADDRESS_MEMORY_ZERO_PAGE_BEGIN ... ADDRESS_MEMORY_ZERO_PAGE_END:
-							case ADDRESS_PROCESSOR_MASKABLE_BEGIN ... ADDRESS_PROCESSOR_MASKABLE_END:
-							case ADDRESS_PROCESSOR_NON_MASKABLE_BEGIN ... ADDRESS_PROCESSOR_NON_MASKABLE_END:
-							case ADDRESS_PROCESSOR_RESET_BEGIN ... ADDRESS_PROCESSOR_RESET_END:
-							case ADDRESS_VIDEO_BEGIN ... ADDRESS_VIDEO_END:
-								write(address, data[index]);
-								break;
-							default:
-								TRACE_MESSAGE_FORMAT(LEVEL_WARNING, "Attempted to load into read-only memory",
+						while(index < length) {
+							c65_byte_t *target;
+							c65_address_t address;
+
+							address.word = ((index + base.word) & UINT16_MAX);
+							count = (ADDRESS_PAGE_LENGTH - address.low);
+							if(count > (length - index)) {
+								count = (length - index);
+							}
+
+							if(m_watch_page_write.test(address.high) || !REGION_EMPTY(m_region[address.high])) {
+								count = 0;
+							} else if((target = page_data(address.high))) {
+								std::memcpy(&target[address.low], &data[index], count);
+							} else if(m_video.data(address)) {
+								m_video.load(&data[index], count, address);
+							} else {
+								count = 0;
+							}
+
+							if(count) {
+								changed = true;
+								page_dirty(address.high, address.high);
+								index += count;
+								continue;
+							}
+
+							if(BANK_REGISTER(m_banking, address.word)) {
+								TRACE_MESSAGE_FORMAT(LEVEL_WARNING, "Attempted to load into bank register",
 									"%u(%04x)", address.word, address.word);
-								break;
+								++index;
+								continue;
+							}
+
+							switch(address.word) {
+								case ADDRESS_MEMORY_HIGH_BEGIN ... ADDRESS_MEMORY_HIGH_END:
+								case ADDRESS_MEMORY_STACK_BEGIN ... ADDRESS_MEMORY_STACK_END:
+								case ADDRESS_MEMORY_ZERO_PAGE_BEGIN ... ADDRESS_MEMORY_ZERO_PAGE_END:
+								case ADDRESS_PROCESSOR_MASKABLE_BEGIN ... ADDRESS_PROCESSOR_MASKABLE_END:
+								case ADDRESS_PROCESSOR_NON_MASKABLE_BEGIN ... ADDRESS_PROCESSOR_NON_MASKABLE_END:
+								case ADDRESS_PROCESSOR_RESET_BEGIN ... ADDRESS_PROCESSOR_RESET_END:
+								case ADDRESS_VIDEO_BEGIN ... ADDRESS_VIDEO_END:
+									store(address, data[index]);
+									break;
+								default:
+									TRACE_MESSAGE_FORMAT(LEVEL_WARNING, "Attempted to load into read-only memory",
+										"%u(%04x)", address.word, address.word);
+									break;
+							}
+
+							++index;
+						}
+
+						if(changed) {
+							m_processor.flush();
 						}
+					} catch(...) {
+						bank_select(previous);
+						throw;
 					}
+
+					bank_select(previous);
 				} catch(c65::type::exception &exc) {
 					m_error = exc.to_string();
 					result = EXIT_FAILURE;
@@ -577,19 +894,32 @@ namespace c65 {
 				return result;
 			}
 
-			int reset(void)
+			int memory_view(
+				__in c65_memory_view_t *view
+				)
 			{
 				int result = EXIT_SUCCESS;
 
-				TRACE_ENTRY();
+				TRACE_ENTRY_FORMAT("View=%p", view);
 
 				try {
-					TRACE_MESSAGE(LEVEL_INFORMATION, "Runtime reset request");
+					c65_address_t address;
+
+					if(!view) {
+						THROW_C65_RUNTIME_EXCEPTION_FORMAT(C65_RUNTIME_EXCEPTION_VIEW_INVALID, "%p", view);
+					}
 
 					initialize();
-					m_processor.reset(*this);
-					m_video.clear();
-					m_cycle = 0;
+
+					address.word = ADDRESS_MEMORY_ZERO_PAGE_BEGIN;
+					view->zero_page = m_memory.data(address);
+					address.word = ADDRESS_MEMORY_STACK_BEGIN;
+					view->stack = m_memory.data(address);
+					address.word = ADDRESS_VIDEO_BEGIN;
+					view->video = m_video.data(address);
+					address.word = ADDRESS_MEMORY_HIGH_BEGIN;
+					view->high = m_memory.data(address);
+					view->dirty = m_dirty.data();
 				} catch(c65::type::exception &exc) {
 					m_error = exc.to_string();
 					result = EXIT_FAILURE;
@@ -602,51 +932,183 @@ namespace c65 {
 				return result;
 			}
 
-			int run(void)
+			int read_block(
+				__in c65_byte_t *data,
+				__in c65_dword_t length,
+				__in c65_address_t base
+				)
 			{
 				int result = EXIT_SUCCESS;
 
-				TRACE_ENTRY();
+				TRACE_ENTRY_FORMAT("Data[%u(%08x)]=%p, Base=%u(%04x)", length, length, data, base.word, base.word);
 
 				try {
-					int remaining = 0;
-					bool interrupted = false;
-					uint32_t begin = 0, current = 0;
-
-					TRACE_MESSAGE(LEVEL_INFORMATION, "Runtime run request");
+					uint32_t count, index = 0;
 
 					initialize();
 
-					TRACE_MESSAGE(LEVEL_INFORMATION, "Runtime loop entry");
-
-					while(!interrupted) {
-						float frequency, rate;
-						uint32_t end = SDL_GetTicks();
-
-						rate = (end - begin);
-						if(rate >= MILLISECONDS_PER_SECOND) {
-							rate = (current - ((rate - MILLISECONDS_PER_SECOND) / (float)FRAMES_PER_SECOND));
-							rate = ((rate > 0.f) ? rate : 0.f);
-
-							TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Runtime framerate", "%.02f", rate);
+					while(index < length) {
+						c65_address_t address;
 
-#ifndef NDEBUG
-							m_video.frame_rate(rate);
-#endif // NDEBUG
-							begin = end;
-							current = 0;
+						address.word = ((index + base.word) & UINT16_MAX);
+						count = (ADDRESS_PAGE_LENGTH - address.low);
+						if(count > (length - index)) {
+							count = (length - index);
 						}
 
-						if(!poll()) {
-							TRACE_MESSAGE(LEVEL_INFORMATION, "Runtime loop exiting");
-							break;
-						}
+						const page_t &page = m_page_table[address.high];
 
-						remaining = (CYCLES_PER_FRAME - remaining);
-						while(remaining > 0) {
-							uint8_t last;
+						if(page.read) {
+							std::memcpy(&data[index], &page.read[address.low], count);
+							index += count;
+						} else {
 
-							if(!m_breakpoint.empty()) {
+							for(; count; --count, ++index, ++address.word) {
+								data[index] = peek(address);
+							}
+						}
+					}
+				} catch(c65::type::exception &exc) {
+					m_error = exc.to_string();
+					result = EXIT_FAILURE;
+				} catch(std::exception &exc) {
+					m_error = exc.what();
+					result = EXIT_FAILURE;
+				}
+
+				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+				return result;
+			}
+
+			int region(
+				__in c65_address_t base,
+				__in c65_dword_t length,
+				__in const c65_region_t *region
+				)
+			{
+				int result = EXIT_SUCCESS;
+
+				TRACE_ENTRY_FORMAT("Base=%u(%04x), Length=%u(%08x), Region=%p", base.word, base.word, length, length, region);
+
+				try {
+					uint32_t index;
+
+					TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Runtime region request", "%u(%04x), %u(%08x), %p",
+						base.word, base.word, length, length, region);
+
+					initialize();
+
+					if(base.low || !length || (length % ADDRESS_PAGE_LENGTH)
+							|| (length > (uint32_t)((ADDRESS_PAGE_COUNT * ADDRESS_PAGE_LENGTH) - base.word))
+							|| (region && REGION_EMPTY(*region))) {
+						THROW_C65_RUNTIME_EXCEPTION_FORMAT(C65_RUNTIME_EXCEPTION_REGION_INVALID, "%u(%04x), %u(%08x), %p",
+							base.word, base.word, length, length, region);
+					}
+
+					for(index = 0; index < length; index += ADDRESS_PAGE_LENGTH) {
+						c65_region_t &entry = m_region.at(base.high + (index / ADDRESS_PAGE_LENGTH));
+
+						entry = {};
+						if(region) {
+							entry = *region;
+
+							if(entry.data) {
+								entry.data += index;
+							}
+						}
+					}
+
+					page_map(ADDRESS_PAGE(base.word), ADDRESS_PAGE(base.word + length - 1));
+					page_dirty(ADDRESS_PAGE(base.word), ADDRESS_PAGE(base.word + length - 1));
+
+					for(index = 0; index < length; ++index) {
+						c65_address_t address;
+
+						address.word = (base.word + index);
+						m_processor.invalidate(address);
+					}
+				} catch(c65::type::exception &exc) {
+					m_error = exc.to_string();
+					result = EXIT_FAILURE;
+				} catch(std::exception &exc) {
+					m_error = exc.what();
+					result = EXIT_FAILURE;
+				}
+
+				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+				return result;
+			}
+
+			int reset(void)
+			{
+				int result = EXIT_SUCCESS;
+
+				TRACE_ENTRY();
+
+				try {
+					TRACE_MESSAGE(LEVEL_INFORMATION, "Runtime reset request");
+
+					initialize();
+					m_processor.reset(*this);
+					m_video.clear();
+					m_cycle = 0;
+				} catch(c65::type::exception &exc) {
+					m_error = exc.to_string();
+					result = EXIT_FAILURE;
+				} catch(std::exception &exc) {
+					m_error = exc.what();
+					result = EXIT_FAILURE;
+				}
+
+				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+				return result;
+			}
+
+			int run(void)
+			{
+				int result = EXIT_SUCCESS;
+
+				TRACE_ENTRY();
+
+				try {
+					int remaining = 0;
+					bool interrupted = false;
+					uint32_t begin = 0, current = 0;
+
+					TRACE_MESSAGE(LEVEL_INFORMATION, "Runtime run request");
+
+					initialize();
+
+					TRACE_MESSAGE(LEVEL_INFORMATION, "Runtime loop entry");
+
+					while(!interrupted) {
+						float frequency, rate;
+						uint32_t end = SDL_GetTicks();
+
+						rate = (end - begin);
+						if(rate >= MILLISECONDS_PER_SECOND) {
+							rate = (current - ((rate - MILLISECONDS_PER_SECOND) / (float)FRAMES_PER_SECOND));
+							rate = ((rate > 0.f) ? rate : 0.f);
+
+							TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Runtime framerate", "%.02f", rate);
+
+#ifndef NDEBUG
+							m_video.frame_rate(rate);
+#endif // NDEBUG
+							begin = end;
+							current = 0;
+						}
+
+						if(!poll()) {
+							TRACE_MESSAGE(LEVEL_INFORMATION, "Runtime loop exiting");
+							break;
+						}
+
+						remaining = (CYCLES_PER_FRAME - remaining);
+						while(remaining > 0) {
+							uint32_t last;
+
+							if(m_breakpoint_count) {
 
 								interrupted = breakpoint_check();
 								if(interrupted) {
@@ -655,8 +1117,7 @@ namespace c65 {
 								}
 							}
 
-							m_random = std::rand();
-							last = m_processor.step(*this);
+							last = m_processor.run(*this, remaining, m_breakpoint_count ? &m_breakpoint : nullptr);
 
 							remaining -= last;
 							m_cycle += last;
@@ -698,12 +1159,11 @@ namespace c65 {
 
 					initialize();
 
-					if(!m_breakpoint.empty()) {
+					if(m_breakpoint_count) {
 						interrupted = breakpoint_check();
 					}
 
 					if(!interrupted) {
-						m_random = std::rand();
 						m_cycle += m_processor.step(*this);
 					}
 
@@ -722,41 +1182,189 @@ namespace c65 {
 
 			int unload(
 				__in c65_address_t base,
-				__in c65_dword_t length
+				__in c65_dword_t length,
+				__in c65_byte_t bank
 				)
 			{
 				int result = EXIT_SUCCESS;
 
-				TRACE_ENTRY();
+				TRACE_ENTRY_FORMAT("Base=%u(%04x), Length=%u(%08x), Bank=%u(%02x)", base.word, base.word, length, length,
+					bank, bank);
 
 				try {
-					uint32_t index;
+					c65_byte_t previous;
+					bool changed = false;
+					uint32_t count, index = 0;
 
-					TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Runtime unload request", "%u(%04x), %u(%08x)",
-						base.word, base.word, length, length);
+					TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Runtime unload request", "%u(%04x), %u(%08x), %u(%02x)",
+						base.word, base.word, length, length, bank, bank);
 
 					initialize();
+					bank_check(base, length, bank);
+					previous = bank_select(bank);
 
-					for(index = base.word; index < (base.word + length); ++index) {
-						c65_address_t address;
+					try {
+
+						while(index < length) {
+							c65_byte_t *target;
+							c65_address_t address;
+
+							address.word = ((index + base.word) & UINT16_MAX);
+							count = (ADDRESS_PAGE_LENGTH - address.low);
+							if(count > (length - index)) {
+								count = (length - index);
+							}
+
+							if(m_watch_page_write.test(address.high) || !REGION_EMPTY(m_region[address.high])) {
+								count = 0;
+							} else if((target = page_data(address.high))) {
+								std::memset(&target[address.low], MEMORY_FILL, count);
+							} else if(m_video.data(address)) {
+								m_video.fill(address, count, MEMORY_ZERO);
+							} else {
+								count = 0;
+							}
+
+							if(count) {
+								changed = true;
+								page_dirty(address.high, address.high);
+								index += count;
+								continue;
+							}
 
-						address.word = (index & UINT16_MAX);
-						switch(address.word) {
-							case ADDRESS_MEMORY_HIGH_BEGIN ... ADDRESS_MEMORY_HIGH_END:
-							case ADDRESS_MEMORY_STACK_BEGIN ... ADDRESS_MEMORY_STACK_END:
-							case ADDRESS_MEMORY_ZERO_PAGE_BEGIN ... ADDRESS_MEMORY_ZERO_PAGE_END:
-								write(address, MEMORY_FILL);
-								break;
-							case ADDRESS_PROCESSOR_MASKABLE_BEGIN ... ADDRESS_PROCESSOR_MASKABLE_END:
-							case ADDRESS_PROCESSOR_NON_MASKABLE_BEGIN ... ADDRESS_PROCESSOR_NON_MASKABLE_END:
-							case ADDRESS_PROCESSOR_RESET_BEGIN ... ADDRESS_PROCESSOR_RESET_END:
-							case ADDRESS_VIDEO_BEGIN ... ADDRESS_VIDEO_END:
-								write(address, MEMORY_ZERO);
-								break;
-							default:
-								TRACE_MESSAGE_FORMAT(LEVEL_WARNING, "Attempted to unload from read-only memory",
+							if(BANK_REGISTER(m_banking, address.word)) {
+								TRACE_MESSAGE_FORMAT(LEVEL_WARNING, "Attempted to unload from bank register",
 									"%u(%04x)", address.word, address.word);
-								break;
+								++index;
+								continue;
+							}
+
+							switch(address.word) {
+								case ADDRESS_MEMORY_HIGH_BEGIN ... ADDRESS_MEMORY_HIGH_END:
+								case ADDRESS_MEMORY_STACK_BEGIN ... ADDRESS_MEMORY_STACK_END:
+								case ADDRESS_MEMORY_ZERO_PAGE_BEGIN ... ADDRESS_MEMORY_ZERO_PAGE_END:
+									store(address, MEMORY_FILL);
+									break;
+								case ADDRESS_PROCESSOR_MASKABLE_BEGIN ... ADDRESS_PROCESSOR_MASKABLE_END:
+								case ADDRESS_PROCESSOR_NON_MASKABLE_BEGIN ... ADDRESS_PROCESSOR_NON_MASKABLE_END:
+								case ADDRESS_PROCESSOR_RESET_BEGIN ... ADDRESS_PROCESSOR_RESET_END:
+								case ADDRESS_VIDEO_BEGIN ... ADDRESS_VIDEO_END:
+									store(address, MEMORY_ZERO);
+									break;
+								default:
+									TRACE_MESSAGE_FORMAT(LEVEL_WARNING, "Attempted to unload from read-only memory",
+										"%u(%04x)", address.word, address.word);
+									break;
+							}
+
+							++index;
+						}
+
+						if(changed) {
+							m_processor.flush();
+						}
+					} catch(...) {
+						bank_select(previous);
+						throw;
+					}
+
+					bank_select(previous);
+				} catch(c65::type::exception &exc) {
+					m_error = exc.to_string();
+					result = EXIT_FAILURE;
+				} catch(std::exception &exc) {
+					m_error = exc.what();
+					result = EXIT_FAILURE;
+				}
+
+				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+				return result;
+			}
+
+			int watch(
+				__in c65_address_t base,
+				__in c65_dword_t length,
+				__in const c65_watch_t *watch
+				)
+			{
+				int result = EXIT_SUCCESS;
+
+				TRACE_ENTRY_FORMAT("Base=%u(%04x), Length=%u(%08x), Watch=%p", base.word, base.word, length, length, watch);
+
+				try {
+					uint32_t address;
+
+					TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Runtime watch request", "%u(%04x), %u(%08x), %p",
+						base.word, base.word, length, length, watch);
+
+					initialize();
+
+					if(!length || (length > (uint32_t)((ADDRESS_PAGE_COUNT * ADDRESS_PAGE_LENGTH) - base.word))
+							|| (watch && (!watch->type || (watch->type & ~WATCH_MASK)
+								|| !(MASK_CHECK(watch->type, C65_WATCH_READ) || MASK_CHECK(watch->type, C65_WATCH_WRITE))))) {
+						THROW_C65_RUNTIME_EXCEPTION_FORMAT(C65_RUNTIME_EXCEPTION_WATCH_INVALID, "%u(%04x), %u(%08x), %p",
+							base.word, base.word, length, length, watch);
+					}
+
+					for(address = base.word; address < (base.word + length); ++address) {
+						m_watch_read.set(address, watch && MASK_CHECK(watch->type, C65_WATCH_READ));
+						m_watch_value[address] = ((watch && MASK_CHECK(watch->type, C65_WATCH_VALUE))
+										? watch->value : WATCH_VALUE_ANY);
+						m_watch_write.set(address, watch && MASK_CHECK(watch->type, C65_WATCH_WRITE));
+					}
+
+					watch_map(ADDRESS_PAGE(base.word), ADDRESS_PAGE(base.word + length - 1));
+				} catch(c65::type::exception &exc) {
+					m_error = exc.to_string();
+					result = EXIT_FAILURE;
+				} catch(std::exception &exc) {
+					m_error = exc.what();
+					result = EXIT_FAILURE;
+				}
+
+				TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+				return result;
+			}
+
+			int write_block(
+				__in const c65_byte_t *data,
+				__in c65_dword_t length,
+				__in c65_address_t base
+				)
+			{
+				int result = EXIT_SUCCESS;
+
+				TRACE_ENTRY_FORMAT("Data[%u(%08x)]=%p, Base=%u(%04x)", length, length, data, base.word, base.word);
+
+				try {
+					uint32_t count, index = 0;
+
+					initialize();
+
+					while(index < length) {
+						c65_address_t address;
+
+						address.word = ((index + base.word) & UINT16_MAX);
+						count = (ADDRESS_PAGE_LENGTH - address.low);
+						if(count > (length - index)) {
+							count = (length - index);
+						}
+
+						const page_t &page = m_page_table[address.high];
+
+						if(page.write && !m_watch_page_write.test(address.high)) {
+							std::memcpy(&page.write[address.low], &data[index], count);
+							page_dirty(address.high, address.high);
+							index += count;
+
+							for(; count; --count, ++address.word) {
+								m_processor.invalidate(address);
+							}
+						} else {
+
+							for(; count; --count, ++index, ++address.word) {
+								write(address, data[index]);
+							}
 						}
 					}
 				} catch(c65::type::exception &exc) {
@@ -775,13 +1383,29 @@ namespace c65 {
 
 			friend class c65::interface::singleton<c65::runtime>;
 
+			typedef struct {
+				uint32_t hit;
+				std::vector<c65_condition_t> predicate;
+			} breakpoint_t;
+
 			runtime(void) :
+				m_banking(false),
+				m_breakpoint_count(0),
 				m_cycle(0),
+				m_dirty(C65_MEMORY_VIEW_DIRTY_LENGTH, 0),
 				m_key(0),
 				m_memory(c65::system::memory::instance()),
+				m_page_table(ADDRESS_PAGE_COUNT, page_t()),
 				m_processor(c65::system::processor::instance()),
 				m_random(0),
-				m_video(c65::system::video::instance())
+				m_region(ADDRESS_PAGE_COUNT, c65_region_t()),
+				m_ring(C65_EVENT_RING_LENGTH, c65_event_entry_t()),
+				m_ring_enabled(false),
+				m_ring_head(0),
+				m_ring_overflow(0),
+				m_ring_tail(0),
+				m_video(c65::system::video::instance()),
+				m_watch_value(UINT16_MAX + 1, WATCH_VALUE_ANY)
 			{
 				TRACE_ENTRY();
 
@@ -798,6 +1422,62 @@ namespace c65 {
 				__in const runtime &other
 				) = delete;
 
+			void bank_check(
+				__in c65_address_t base,
+				__in c65_dword_t length,
+				__in c65_byte_t bank
+				)
+			{
+				TRACE_ENTRY_FORMAT("Base=%u(%04x), Length=%u(%08x), Bank=%u(%02x)", base.word, base.word, length, length,
+					bank, bank);
+
+				if(bank && (!m_banking || (base.word < ADDRESS_MEMORY_BANK_BEGIN) || (base.word > ADDRESS_MEMORY_BANK_END)
+						|| (length > (uint32_t)(ADDRESS_MEMORY_BANK_END - base.word + 1)))) {
+					THROW_C65_RUNTIME_EXCEPTION_FORMAT(C65_RUNTIME_EXCEPTION_BANK_INVALID, "%u(%04x), %u(%08x), %u(%02x)",
+						base.word, base.word, length, length, bank, bank);
+				}
+
+				TRACE_EXIT();
+			}
+
+			c65_byte_t bank_select(
+				__in c65_byte_t bank
+				)
+			{
+				c65_byte_t result;
+				c65_address_t address;
+
+				TRACE_ENTRY_FORMAT("Bank=%u(%02x)", bank, bank);
+
+				address.word = ADDRESS_MEMORY_BANK;
+
+				result = m_memory.read_bank();
+				if(result != bank) {
+
+					// host bank switches write the register directly, so they never trigger the guest write watches
+					m_processor.invalidate(address);
+					bank_write(bank);
+					page_dirty(address.high, address.high);
+				}
+
+				TRACE_EXIT_FORMAT("Result=%u(%02x)", result, result);
+				return result;
+			}
+
+			void bank_write(
+				__in c65_byte_t bank
+				)
+			{
+				TRACE_ENTRY_FORMAT("Bank=%u(%02x)", bank, bank);
+
+				m_memory.write_bank(bank);
+				page_map(ADDRESS_PAGE(ADDRESS_MEMORY_BANK_BEGIN), ADDRESS_PAGE(ADDRESS_MEMORY_BANK_END));
+				page_dirty(ADDRESS_PAGE(ADDRESS_MEMORY_BANK_BEGIN), ADDRESS_PAGE(ADDRESS_MEMORY_BANK_END));
+				m_processor.flush();
+
+				TRACE_EXIT();
+			}
+
 			bool breakpoint_check(void)
 			{
 				bool result;
@@ -807,9 +1487,79 @@ namespace c65 {
 
 				address.word = m_processor.read_register(C65_REGISTER_PROGRAM_COUNTER).word;
 
-				result = (m_breakpoint.find(address.word) != m_breakpoint.end());
+				result = m_breakpoint.test(address.word);
 				if(result) {
-					notify(C65_EVENT_BREAKPOINT, address);
+					std::map<c65_word_t, breakpoint_t>::iterator entry = m_breakpoint_condition.find(address.word);
+
+					if(entry != m_breakpoint_condition.end()) {
+						result = breakpoint_evaluate(entry->second);
+					}
+
+					if(result) {
+						notify(C65_EVENT_BREAKPOINT, address);
+					}
+				}
+
+				TRACE_EXIT_FORMAT("Result=%x", result);
+				return result;
+			}
+
+			bool breakpoint_evaluate(
+				__inout breakpoint_t &breakpoint
+				)
+			{
+				bool result = true;
+				std::vector<c65_condition_t>::const_iterator condition;
+
+				TRACE_ENTRY_FORMAT("Breakpoint=%p", &breakpoint);
+
+				++breakpoint.hit;
+
+				for(condition = breakpoint.predicate.begin(); result && (condition != breakpoint.predicate.end());
+						++condition) {
+					c65_dword_t value = 0;
+					c65_address_t address;
+
+					switch(condition->type) {
+						case C65_CONDITION_HIT:
+							value = breakpoint.hit;
+							break;
+						case C65_CONDITION_MEMORY:
+							address.word = condition->operand;
+							value = peek(address);
+							break;
+						case C65_CONDITION_REGISTER:
+							value = m_processor.read_register(condition->operand).word;
+							break;
+						case C65_CONDITION_STATUS:
+							value = (m_processor.read_status().raw & condition->operand);
+							break;
+						default:
+							break;
+					}
+
+					switch(condition->compare) {
+						case C65_COMPARE_EQUAL:
+							result = (value == condition->value);
+							break;
+						case C65_COMPARE_NOT_EQUAL:
+							result = (value != condition->value);
+							break;
+						case C65_COMPARE_LESS:
+							result = (value < condition->value);
+							break;
+						case C65_COMPARE_LESS_EQUAL:
+							result = (value <= condition->value);
+							break;
+						case C65_COMPARE_GREATER:
+							result = (value > condition->value);
+							break;
+						case C65_COMPARE_GREATER_EQUAL:
+							result = (value >= condition->value);
+							break;
+						default:
+							break;
+					}
 				}
 
 				TRACE_EXIT_FORMAT("Result=%x", result);
@@ -838,10 +1588,13 @@ namespace c65 {
 				m_event.resize(C65_EVENT_MAX + 1, nullptr);
 				m_key = 0;
 				m_random = 0;
+				subscription_map();
 
 				m_memory.initialize();
 				m_processor.initialize();
 				m_video.initialize();
+				page_map(0, ADDRESS_PAGE_COUNT - 1);
+				page_dirty(0, ADDRESS_PAGE_COUNT - 1);
 
 				TRACE_MESSAGE(LEVEL_INFORMATION, "Runtime initialized");
 
@@ -858,7 +1611,9 @@ namespace c65 {
 					TRACE_MESSAGE_FORMAT(LEVEL_VERBOSE, "Runtime event notification", "%i(%s), %p",
 						event.type, EVENT_STRING(event.type), &event);
 
-					if(m_event.at(event.type)) {
+					if(m_ring_enabled) {
+						ring_push(event);
+					} else if(m_event.at(event.type)) {
 						m_event.at(event.type)(&event);
 					}
 				} catch(...) { }
@@ -870,33 +1625,25 @@ namespace c65 {
 				__in c65_address_t address
 				) const override
 			{
-				c65_byte_t result = MEMORY_ZERO;
+				c65_byte_t result;
 
 				TRACE_ENTRY_FORMAT("Address=%u(%04x)", address.word, address.word);
 
-				switch(address.word) {
-					case ADDRESS_KEY:
-						result = m_key;
-						break;
-					case ADDRESS_MEMORY_HIGH_BEGIN ... ADDRESS_MEMORY_HIGH_END:
-					case ADDRESS_MEMORY_STACK_BEGIN ... ADDRESS_MEMORY_STACK_END:
-					case ADDRESS_MEMORY_ZERO_PAGE_BEGIN ... ADDRESS_MEMORY_ZERO_PAGE_END:
-						result = m_memory.read(address);
-						break;
-					case ADDRESS_PROCESSOR_MASKABLE_BEGIN ... ADDRESS_PROCESSOR_MASKABLE_END:
-					case ADDRESS_PROCESSOR_NON_MASKABLE_BEGIN ... ADDRESS_PROCESSOR_NON_MASKABLE_END:
-					case ADDRESS_PROCESSOR_RESET_BEGIN ... ADDRESS_PROCESSOR_RESET_END:
-						result = m_processor.read(address);
-						break;
-					case ADDRESS_RANDOM:
-						result = m_random;
-						break;
-					case ADDRESS_VIDEO_BEGIN ... ADDRESS_VIDEO_END:
-						result = m_video.read(address);
-						break;
-					default:
-						THROW_C65_RUNTIME_EXCEPTION_FORMAT(C65_RUNTIME_EXCEPTION_ADDRESS_INVALID,
-							"%u(%04x)", address.word, address.word);
+				const c65_region_t &region = m_region[address.high];
+
+				if(!region.data && region.read) {
+					result = region.read(region.context, address);
+					m_processor.invalidate(address);
+				} else if((address.word == ADDRESS_RANDOM) && REGION_EMPTY(region)) {
+					m_random = std::rand();
+					result = m_random;
+					m_processor.invalidate(address);
+				} else {
+					result = peek(address);
+				}
+
+				if(m_watch_read.test(address.word)) {
+					watch_check(C65_EVENT_WATCH_READ, address, result);
 				}
 
 				TRACE_EXIT_FORMAT("Result=%u(%02x)", result, result);
@@ -909,14 +1656,24 @@ namespace c65 {
 
 				TRACE_MESSAGE(LEVEL_INFORMATION, "Runtime uninitializing");
 
+				m_banking = false;
+				m_page = nullptr;
+				m_dirty.assign(C65_MEMORY_VIEW_DIRTY_LENGTH, 0);
+				m_page_table.assign(ADDRESS_PAGE_COUNT, page_t());
+				m_region.assign(ADDRESS_PAGE_COUNT, c65_region_t());
+				m_ring_enabled = false;
+				m_ring_head.store(0, std::memory_order_relaxed);
+				m_ring_overflow.store(0, std::memory_order_relaxed);
+				m_ring_tail.store(0, std::memory_order_relaxed);
 				m_video.uninitialize();
 				m_processor.uninitialize();
 				m_memory.uninitialize();
 
-				m_random = 0;
 				m_key = 0;
+				m_random = 0;
 				m_event.clear();
 				m_cycle = 0;
+				subscription_map();
 
 				SDL_Quit();
 
@@ -934,29 +1691,107 @@ namespace c65 {
 			{
 				TRACE_ENTRY_FORMAT("Address=%u(%04x), Value=%u(%02x)", address.word, address.word, value, value);
 
-				if(!m_watch.empty()) {
-					watch_check(address, value);
+				if(MASK_CHECK(m_page_table[address.high].attribute, C65_ATTRIBUTE_READ_ONLY)) {
+					TRACE_MESSAGE_FORMAT(LEVEL_WARNING, "Attempted to write to read-only page", "%u(%04x)",
+						address.word, address.word);
+					notify(C65_EVENT_PROTECTION_FAULT, address, MASK(C65_ATTRIBUTE_READ_ONLY));
+				} else {
+					store(address, value);
 				}
 
-				switch(address.word) {
-					case ADDRESS_MEMORY_HIGH_BEGIN ... ADDRESS_MEMORY_HIGH_END:
-					case ADDRESS_MEMORY_STACK_BEGIN ... ADDRESS_MEMORY_STACK_END:
-					case ADDRESS_MEMORY_ZERO_PAGE_BEGIN ... ADDRESS_MEMORY_ZERO_PAGE_END:
-						m_memory.write(address, value);
-						break;
-					case ADDRESS_PROCESSOR_MASKABLE_BEGIN ... ADDRESS_PROCESSOR_MASKABLE_END:
-					case ADDRESS_PROCESSOR_NON_MASKABLE_BEGIN ... ADDRESS_PROCESSOR_NON_MASKABLE_END:
-					case ADDRESS_PROCESSOR_RESET_BEGIN ... ADDRESS_PROCESSOR_RESET_END:
-						m_processor.write(address, value);
-						break;
-					case ADDRESS_VIDEO_BEGIN ... ADDRESS_VIDEO_END:
-						m_video.write(address, value);
-						break;
-					default:
-						THROW_C65_RUNTIME_EXCEPTION_FORMAT(C65_RUNTIME_EXCEPTION_ADDRESS_INVALID,
-							"%u(%04x)", address.word, address.word);
+				TRACE_EXIT();
+			}
+
+			c65_byte_t *page_data(
+				__in uint8_t page
+				)
+			{
+				c65_byte_t *result;
+				c65_address_t first, last;
+
+				TRACE_ENTRY_FORMAT("Page=%u(%02x)", page, page);
+
+				first.high = page;
+				first.low = 0;
+				last.high = page;
+				last.low = UINT8_MAX;
+
+				result = m_memory.data(first);
+				if(result && (m_memory.data(last) != (result + UINT8_MAX))) {
+					result = nullptr;
+				}
+
+				TRACE_EXIT_FORMAT("Result=%p", result);
+				return result;
+			}
+
+			void page_dirty(
+				__in uint32_t begin,
+				__in uint32_t end
+				)
+			{
+				uint32_t page = begin;
+
+				TRACE_ENTRY_FORMAT("Begin=%u(%02x), End=%u(%02x)", begin, begin, end, end);
+
+				for(; page <= end; ++page) {
+					c65_dword_t &entry = m_dirty[DIRTY_INDEX(page)];
+
+					if(!(__atomic_load_n(&entry, __ATOMIC_RELAXED) & DIRTY_MASK(page))) {
+						__atomic_fetch_or(&entry, DIRTY_MASK(page), __ATOMIC_RELAXED);
+					}
+				}
+
+				TRACE_EXIT();
+			}
+
+			void page_map(
+				__in uint32_t begin,
+				__in uint32_t end
+				)
+			{
+				uint32_t page = begin;
+
+				TRACE_ENTRY_FORMAT("Begin=%u(%02x), End=%u(%02x)", begin, begin, end, end);
+
+				for(; page <= end; ++page) {
+					c65_address_t first, last;
+					page_t &entry = m_page_table.at(page);
+					const c65_region_t &region = m_region.at(page);
+
+					first.high = page;
+					first.low = 0;
+					last.high = page;
+					last.low = UINT8_MAX;
+					entry.read = nullptr;
+					entry.write = nullptr;
+
+					if(!MASK_CHECK(entry.attribute, C65_ATTRIBUTE_MMIO)) {
+
+						if(!REGION_EMPTY(region)) {
+							entry.read = region.data;
+							entry.write = (region.write ? nullptr : region.data);
+						} else if((entry.write = page_data(page))) {
+							entry.read = entry.write;
+						} else if(m_video.data(first) && (m_video.data(last) == (m_video.data(first) + UINT8_MAX))) {
+							entry.read = m_video.data(first);
+						}
+
+						if(MASK_CHECK(entry.attribute, C65_ATTRIBUTE_READ_ONLY)) {
+							entry.write = nullptr;
+						}
+
+						if(m_watch_page_read.test(page)) {
+							entry.read = nullptr;
+						}
+					}
+
+					TRACE_MESSAGE_FORMAT(LEVEL_VERBOSE, "Runtime page", "[%02x] %p, %p, %02x", page, entry.read, entry.write,
+						entry.attribute);
 				}
 
+				m_page = m_page_table.data();
+
 				TRACE_EXIT();
 			}
 
@@ -1005,27 +1840,208 @@ namespace c65 {
 				return result;
 			}
 
+			c65_byte_t peek(
+				__in c65_address_t address
+				) const
+			{
+				c65_byte_t result = MEMORY_ZERO;
+
+				TRACE_ENTRY_FORMAT("Address=%u(%04x)", address.word, address.word);
+
+				const c65_region_t &region = m_region[address.high];
+
+				// host reads never call region handlers, draw a new random value or check read watches
+				if(!REGION_EMPTY(region)) {
+
+					if(region.data) {
+						result = region.data[address.low];
+					}
+				} else {
+
+					switch(address.word) {
+						case ADDRESS_KEY:
+							result = m_key;
+							break;
+						case ADDRESS_MEMORY_HIGH_BEGIN ... ADDRESS_MEMORY_HIGH_END:
+						case ADDRESS_MEMORY_STACK_BEGIN ... ADDRESS_MEMORY_STACK_END:
+						case ADDRESS_MEMORY_ZERO_PAGE_BEGIN ... ADDRESS_MEMORY_ZERO_PAGE_END:
+							result = (BANK_REGISTER(m_banking, address.word) ? m_memory.read_bank() : m_memory.read(address));
+							break;
+						case ADDRESS_PROCESSOR_MASKABLE_BEGIN ... ADDRESS_PROCESSOR_MASKABLE_END:
+						case ADDRESS_PROCESSOR_NON_MASKABLE_BEGIN ... ADDRESS_PROCESSOR_NON_MASKABLE_END:
+						case ADDRESS_PROCESSOR_RESET_BEGIN ... ADDRESS_PROCESSOR_RESET_END:
+							result = m_processor.read(address);
+							break;
+						case ADDRESS_RANDOM:
+							result = m_random;
+							break;
+						case ADDRESS_VIDEO_BEGIN ... ADDRESS_VIDEO_END:
+							result = m_video.read(address);
+							break;
+	#ifndef NDEBUG
+						default:
+							THROW_C65_RUNTIME_EXCEPTION_FORMAT(C65_RUNTIME_EXCEPTION_ADDRESS_INVALID,
+								"%u(%04x)", address.word, address.word);
+	#endif // NDEBUG
+					}
+				}
+
+				TRACE_EXIT_FORMAT("Result=%u(%02x)", result, result);
+				return result;
+			}
+
+			void ring_push(
+				__in const c65_event_t &event
+				) const
+			{
+				uint32_t head, tail;
+
+				TRACE_ENTRY_FORMAT("Event=%p", &event);
+
+				head = m_ring_head.load(std::memory_order_relaxed);
+				tail = m_ring_tail.load(std::memory_order_acquire);
+
+				if((head - tail) < C65_EVENT_RING_LENGTH) {
+					c65_event_entry_t &entry = m_ring[head & (C65_EVENT_RING_LENGTH - 1)];
+
+					entry.cycle = (m_cycle + m_processor.elapsed());
+					entry.event = event;
+					m_ring_head.store(head + 1, std::memory_order_release);
+				} else {
+					m_ring_overflow.fetch_add(1, std::memory_order_relaxed);
+				}
+
+				TRACE_EXIT();
+			}
+
+			void store(
+				__in c65_address_t address,
+				__in c65_byte_t value
+				)
+			{
+				TRACE_ENTRY_FORMAT("Address=%u(%04x), Value=%u(%02x)", address.word, address.word, value, value);
+
+				if(m_watch_write.test(address.word)) {
+					watch_check(C65_EVENT_WATCH, address, value);
+				}
+
+				m_processor.invalidate(address);
+
+				const page_t &page = m_page_table[address.high];
+
+				if(page.write) {
+					page.write[address.low] = value;
+				} else if(!REGION_EMPTY(m_region[address.high])) {
+					const c65_region_t &region = m_region[address.high];
+
+					if(region.write) {
+						region.write(region.context, address, value);
+					} else if(region.data) {
+						region.data[address.low] = value;
+					}
+				} else {
+
+					switch(address.word) {
+						case ADDRESS_MEMORY_HIGH_BEGIN ... ADDRESS_MEMORY_HIGH_END:
+						case ADDRESS_MEMORY_STACK_BEGIN ... ADDRESS_MEMORY_STACK_END:
+						case ADDRESS_MEMORY_ZERO_PAGE_BEGIN ... ADDRESS_MEMORY_ZERO_PAGE_END:
+
+							if(BANK_REGISTER(m_banking, address.word)) {
+								bank_write(value);
+							} else {
+								m_memory.write(address, value);
+							}
+							break;
+						case ADDRESS_PROCESSOR_MASKABLE_BEGIN ... ADDRESS_PROCESSOR_MASKABLE_END:
+						case ADDRESS_PROCESSOR_NON_MASKABLE_BEGIN ... ADDRESS_PROCESSOR_NON_MASKABLE_END:
+						case ADDRESS_PROCESSOR_RESET_BEGIN ... ADDRESS_PROCESSOR_RESET_END:
+							m_processor.write(address, value);
+							break;
+						case ADDRESS_VIDEO_BEGIN ... ADDRESS_VIDEO_END:
+							m_video.write(address, value);
+							break;
+						default:
+							THROW_C65_RUNTIME_EXCEPTION_FORMAT(C65_RUNTIME_EXCEPTION_ADDRESS_INVALID,
+								"%u(%04x)", address.word, address.word);
+					}
+				}
+
+				page_dirty(address.high, address.high);
+
+				TRACE_EXIT();
+			}
+
+			void subscription_map(void)
+			{
+				TRACE_ENTRY();
+
+				m_subscription = (m_ring_enabled ? EVENT_MASK : 0);
+
+				for(int type = 0; type < (int)m_event.size(); ++type) {
+					if(m_event.at(type)) {
+						MASK_SET(m_subscription, type);
+					}
+				}
+
+				TRACE_EXIT();
+			}
+
 			void watch_check(
+				__in int type,
 				__in c65_address_t address,
 				__in c65_byte_t value
+				) const
+			{
+				TRACE_ENTRY_FORMAT("Type=%i(%s), Address=%u(%04x), Value=%u(%02x)", type, EVENT_STRING(type),
+					address.word, address.word, value, value);
+
+				if((m_watch_value[address.word] == WATCH_VALUE_ANY) || (m_watch_value[address.word] == value)) {
+					notify(type, address, value);
+				}
+
+				TRACE_EXIT();
+			}
+
+			void watch_map(
+				__in uint32_t begin,
+				__in uint32_t end
 				)
 			{
-				std::set<c65_word_t>::const_iterator watch;
+				uint32_t page = begin;
 
-				TRACE_ENTRY_FORMAT("Address=%u(%04x), Value=%u(%02x)", address.word, address.word, value, value);
+				TRACE_ENTRY_FORMAT("Begin=%u(%02x), End=%u(%02x)", begin, begin, end, end);
+
+				for(; page <= end; ++page) {
+					uint32_t address = (page * ADDRESS_PAGE_LENGTH);
+					bool read = false, write = false;
+
+					for(; address < ((page + 1) * ADDRESS_PAGE_LENGTH); ++address) {
+						read = (read || m_watch_read.test(address));
+						write = (write || m_watch_write.test(address));
+					}
 
-				watch = m_watch.find(address.word);
-				if(watch != m_watch.end()) {
-					notify(C65_EVENT_WATCH, address, value);
+					m_watch_page_read.set(page, read);
+					m_watch_page_write.set(page, write);
 				}
 
+				page_map(begin, end);
+
 				TRACE_EXIT();
 			}
 
-			std::set<c65_word_t> m_breakpoint;
+
+			bool m_banking;
+
+			address_set_t m_breakpoint;
+
+			std::map<c65_word_t, breakpoint_t> m_breakpoint_condition;
+
+			uint32_t m_breakpoint_count;
 
 			c65_dword_t m_cycle;
 
+			std::vector<c65_dword_t> m_dirty;
+
 			std::string m_error;
 
 			std::vector<c65_event_hdlr> m_event;
@@ -1034,13 +2050,35 @@ namespace c65 {
 
 			c65::system::memory &m_memory;
 
+			std::vector<page_t> m_page_table;
+
 			c65::system::processor &m_processor;
 
-			c65_byte_t m_random;
+			mutable c65_byte_t m_random;
+
+			std::vector<c65_region_t> m_region;
+
+			mutable std::vector<c65_event_entry_t> m_ring;
+
+			bool m_ring_enabled;
+
+			mutable std::atomic<uint32_t> m_ring_head;
+
+			mutable std::atomic<uint32_t> m_ring_overflow;
+
+			std::atomic<uint32_t> m_ring_tail;
 
 			c65::system::video &m_video;
 
-			std::set<c65_word_t> m_watch;
+			std::bitset<ADDRESS_PAGE_COUNT> m_watch_page_read;
+
+			std::bitset<ADDRESS_PAGE_COUNT> m_watch_page_write;
+
+			address_set_t m_watch_read;
+
+			std::vector<int16_t> m_watch_value;
+
+			address_set_t m_watch_write;
 	};
 }
 
@@ -1083,6 +2121,23 @@ c65_error(void)
 	return result;
 }
 
+int
+c65_event_drain(
+	__in c65_event_entry_t *entry,
+	__inout c65_dword_t *count,
+	__in_opt c65_dword_t *overflow
+	)
+{
+	int result;
+
+	TRACE_ENTRY_FORMAT("Entry=%p, Count=%p, Overflow=%p", entry, count, overflow);
+
+	result = c65::runtime::instance().event_drain(entry, count, overflow);
+
+	TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+	return result;
+}
+
 int
 c65_event_handler(int type, c65_event_hdlr handler)
 {
@@ -1096,6 +2151,21 @@ c65_event_handler(int type, c65_event_hdlr handler)
 	return result;
 }
 
+int
+c65_event_ring(
+	__in int enable
+	)
+{
+	int result;
+
+	TRACE_ENTRY_FORMAT("Enable=%i", enable);
+
+	result = c65::runtime::instance().event_ring(enable);
+
+	TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+	return result;
+}
+
 int
 c65_interrupt(
 	__in int type
@@ -1122,7 +2192,75 @@ c65_load(
 
 	TRACE_ENTRY_FORMAT("Data[%u(%08x)]=%p, Base=%u(%04x)", length, length, data, base.word, base.word);
 
-	result = c65::runtime::instance().load(data, length, base);
+	result = c65::runtime::instance().load(data, length, base, 0);
+
+	TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+	return result;
+}
+
+int
+c65_load_bank(
+	__in const c65_byte_t *data,
+	__in c65_dword_t length,
+	__in c65_address_t base,
+	__in c65_byte_t bank
+	)
+{
+	int result;
+
+	TRACE_ENTRY_FORMAT("Data[%u(%08x)]=%p, Base=%u(%04x), Bank=%u(%02x)", length, length, data, base.word, base.word,
+		bank, bank);
+
+	result = c65::runtime::instance().load(data, length, base, bank);
+
+	TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+	return result;
+}
+
+int
+c65_memory_view(
+	__in c65_memory_view_t *view
+	)
+{
+	int result;
+
+	TRACE_ENTRY_FORMAT("View=%p", view);
+
+	result = c65::runtime::instance().memory_view(view);
+
+	TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+	return result;
+}
+
+int
+c65_read_block(
+	__in c65_byte_t *data,
+	__in c65_dword_t length,
+	__in c65_address_t base
+	)
+{
+	int result;
+
+	TRACE_ENTRY_FORMAT("Data[%u(%08x)]=%p, Base=%u(%04x)", length, length, data, base.word, base.word);
+
+	result = c65::runtime::instance().read_block(data, length, base);
+
+	TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+	return result;
+}
+
+int
+c65_region(
+	__in c65_address_t base,
+	__in c65_dword_t length,
+	__in const c65_region_t *region
+	)
+{
+	int result;
+
+	TRACE_ENTRY_FORMAT("Base=%u(%04x), Length=%u(%08x), Region=%p", base.word, base.word, length, length, region);
+
+	result = c65::runtime::instance().region(base, length, region);
 
 	TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
 	return result;
@@ -1177,7 +2315,24 @@ c65_unload(
 
 	TRACE_ENTRY_FORMAT("Base=%u(%04x), Length=%u(%08x)", base.word, base.word, length, length);
 
-	result = c65::runtime::instance().unload(base, length);
+	result = c65::runtime::instance().unload(base, length, 0);
+
+	TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+	return result;
+}
+
+int
+c65_unload_bank(
+	__in c65_address_t base,
+	__in c65_dword_t length,
+	__in c65_byte_t bank
+	)
+{
+	int result;
+
+	TRACE_ENTRY_FORMAT("Base=%u(%04x), Length=%u(%08x), Bank=%u(%02x)", base.word, base.word, length, length, bank, bank);
+
+	result = c65::runtime::instance().unload(base, length, bank);
 
 	TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
 	return result;
@@ -1195,3 +2350,37 @@ c65_version(void)
 	TRACE_EXIT_FORMAT("Result=%p", result);
 	return result;
 }
+
+int
+c65_watch(
+	__in c65_address_t base,
+	__in c65_dword_t length,
+	__in const c65_watch_t *watch
+	)
+{
+	int result;
+
+	TRACE_ENTRY_FORMAT("Base=%u(%04x), Length=%u(%08x), Watch=%p", base.word, base.word, length, length, watch);
+
+	result = c65::runtime::instance().watch(base, length, watch);
+
+	TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+	return result;
+}
+
+int
+c65_write_block(
+	__in const c65_byte_t *data,
+	__in c65_dword_t length,
+	__in c65_address_t base
+	)
+{
+	int result;
+
+	TRACE_ENTRY_FORMAT("Data[%u(%08x)]=%p, Base=%u(%04x)", length, length, data, base.word, base.word);
+
+	result = c65::runtime::instance().write_block(data, length, base);
+
+	TRACE_EXIT_FORMAT("Result=%i(%x)", result, result);
+	return result;
+}
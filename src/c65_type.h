@@ -33,9 +33,14 @@ namespace c65 {
 	enum {
 		C65_RUNTIME_EXCEPTION_ACTION_INVALID = 0,
 		C65_RUNTIME_EXCEPTION_ADDRESS_INVALID,
+		C65_RUNTIME_EXCEPTION_ATTRIBUTE_INVALID,
+		C65_RUNTIME_EXCEPTION_BANK_INVALID,
 		C65_RUNTIME_EXCEPTION_BREAKPOINT_INVALID,
+		C65_RUNTIME_EXCEPTION_CONDITION_INVALID,
 		C65_RUNTIME_EXCEPTION_EVENT_INVALID,
 		C65_RUNTIME_EXCEPTION_EXTERNAL,
+		C65_RUNTIME_EXCEPTION_REGION_INVALID,
+		C65_RUNTIME_EXCEPTION_VIEW_INVALID,
 		C65_RUNTIME_EXCEPTION_WATCH_INVALID,
 	};
 
@@ -44,9 +49,14 @@ namespace c65 {
 	static const std::string C65_RUNTIME_EXCEPTION_STR[] = {
 		C65_RUNTIME_EXCEPTION_HEADER "Invalid action", // C65_RUNTIME_EXCEPTION_ACTION_INVALID
 		C65_RUNTIME_EXCEPTION_HEADER "Invalid address", // C65_RUNTIME_EXCEPTION_ADDRESS_INVALID
+		C65_RUNTIME_EXCEPTION_HEADER "Invalid attribute", // C65_RUNTIME_EXCEPTION_ATTRIBUTE_INVALID
+		C65_RUNTIME_EXCEPTION_HEADER "Invalid bank", // C65_RUNTIME_EXCEPTION_BANK_INVALID
 		C65_RUNTIME_EXCEPTION_HEADER "Invalid breakpoint", // C65_RUNTIME_EXCEPTION_BREAKPOINT_INVALID
+		C65_RUNTIME_EXCEPTION_HEADER "Invalid condition", // C65_RUNTIME_EXCEPTION_CONDITION_INVALID
 		C65_RUNTIME_EXCEPTION_HEADER "Invalid event", // C65_RUNTIME_EXCEPTION_EVENT_INVALID
 		C65_RUNTIME_EXCEPTION_HEADER "External exception", // C65_RUNTIME_EXCEPTION_EXTERNAL
+		C65_RUNTIME_EXCEPTION_HEADER "Invalid region", // C65_RUNTIME_EXCEPTION_REGION_INVALID
+		C65_RUNTIME_EXCEPTION_HEADER "Invalid view", // C65_RUNTIME_EXCEPTION_VIEW_INVALID
 		C65_RUNTIME_EXCEPTION_HEADER "Invalid watch", // C65_RUNTIME_EXCEPTION_WATCH_INVALID
 		};
 
@@ -59,8 +69,33 @@ namespace c65 {
 	#define THROW_C65_RUNTIME_EXCEPTION_FORMAT(_EXCEPT_, _FORMAT_, ...) \
 		THROW_EXCEPTION(C65_RUNTIME_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
 
+	static_assert((ADDRESS_MEMORY_ZERO_PAGE_BEGIN == 0)
+			&& (ADDRESS_RANDOM == (ADDRESS_MEMORY_ZERO_PAGE_END + 1))
+			&& (ADDRESS_KEY == (ADDRESS_RANDOM + 1))
+			&& (ADDRESS_MEMORY_STACK_BEGIN == (ADDRESS_KEY + 1))
+			&& (ADDRESS_VIDEO_BEGIN == (ADDRESS_MEMORY_STACK_END + 1))
+			&& (ADDRESS_MEMORY_HIGH_BEGIN == (ADDRESS_VIDEO_END + 1))
+			&& (ADDRESS_PROCESSOR_NON_MASKABLE_BEGIN == (ADDRESS_MEMORY_HIGH_END + 1))
+			&& (ADDRESS_PROCESSOR_RESET_BEGIN == (ADDRESS_PROCESSOR_NON_MASKABLE_END + 1))
+			&& (ADDRESS_PROCESSOR_MASKABLE_BEGIN == (ADDRESS_PROCESSOR_RESET_END + 1))
+			&& (ADDRESS_PROCESSOR_MASKABLE_END == UINT16_MAX), "Address map does not cover the address space");
+
+	static_assert(ADDRESS_MEMORY_BANK <= ADDRESS_MEMORY_ZERO_PAGE_END, "Bank register does not overlay zero page");
+
+	#define BANK_REGISTER(_BANKING_, _ADDRESS_) \
+		((_BANKING_) && ((_ADDRESS_) == ADDRESS_MEMORY_BANK))
+
 	#define CYCLES_PER_FRAME 500
 
+	static_assert(!(C65_EVENT_RING_LENGTH & (C65_EVENT_RING_LENGTH - 1)), "Event ring length is not a power of two");
+
+	#define DIRTY_INDEX(_PAGE_) \
+		((_PAGE_) / 32)
+	#define DIRTY_MASK(_PAGE_) \
+		(1U << ((_PAGE_) % 32))
+
+	static_assert((C65_MEMORY_VIEW_DIRTY_LENGTH * 32) == ADDRESS_PAGE_COUNT, "Dirty bitmap does not cover the page table");
+
 	#define FRAMES_PER_SECOND 60
 	#define FRAME_RATE (MILLISECONDS_PER_SECOND / (float)FRAMES_PER_SECOND)
 
@@ -69,6 +104,9 @@ namespace c65 {
 
 	#define MILLISECONDS_PER_SECOND std::kilo::num
 
+	#define REGION_EMPTY(_REGION_) \
+		(!(_REGION_).data && !(_REGION_).read && !(_REGION_).write)
+
 	#define SDL_FLAGS (SDL_INIT_VIDEO)
 }
 
@@ -23,7 +23,8 @@ namespace c65 {
 
 	namespace system {
 
-		memory::memory(void)
+		memory::memory(void) :
+			m_bank(0)
 		{
 			TRACE_ENTRY();
 			TRACE_EXIT();
@@ -35,6 +36,38 @@ namespace c65 {
 			TRACE_EXIT();
 		}
 
+		c65_byte_t *
+		memory::data(
+			__in c65_address_t address
+			)
+		{
+			c65_byte_t *result = nullptr;
+
+			TRACE_ENTRY_FORMAT("Address=%u(%04x)", address.word, address.word);
+
+			switch(address.word) {
+				case ADDRESS_MEMORY_HIGH_BEGIN ... ADDRESS_MEMORY_HIGH_END:
+
+					if(MEMORY_BANKED(m_bank, address.word)) {
+						result = &m_extended.at(MEMORY_BANK_OFFSET(m_bank, address.word));
+					} else {
+						result = &m_high.at(address.word - ADDRESS_MEMORY_HIGH_BEGIN);
+					}
+					break;
+				case ADDRESS_MEMORY_STACK_BEGIN ... ADDRESS_MEMORY_STACK_END:
+					result = &m_stack.at(address.word - ADDRESS_MEMORY_STACK_BEGIN);
+					break;
+				case ADDRESS_MEMORY_ZERO_PAGE_BEGIN ... ADDRESS_MEMORY_ZERO_PAGE_END:
+					result = &m_zero_page.at(address.word - ADDRESS_MEMORY_ZERO_PAGE_BEGIN);
+					break;
+				default:
+					break;
+			}
+
+			TRACE_EXIT_FORMAT("Result=%p", result);
+			return result;
+		}
+
 		void
 		memory::on_initialize(void)
 		{
@@ -42,6 +75,7 @@ namespace c65 {
 
 			TRACE_MESSAGE(LEVEL_INFORMATION, "Memory initializing");
 
+			m_bank = 0;
 			m_high.resize(ADDRESS_LENGTH(ADDRESS_MEMORY_HIGH_BEGIN, ADDRESS_MEMORY_HIGH_END), MEMORY_FILL);
 			m_stack.resize(ADDRESS_LENGTH(ADDRESS_MEMORY_STACK_BEGIN, ADDRESS_MEMORY_STACK_END), MEMORY_ZERO);
 			m_zero_page.resize(ADDRESS_LENGTH(ADDRESS_MEMORY_ZERO_PAGE_BEGIN, ADDRESS_MEMORY_ZERO_PAGE_END), MEMORY_ZERO);
@@ -71,13 +105,18 @@ namespace c65 {
 
 			switch(address.word) {
 				case ADDRESS_MEMORY_HIGH_BEGIN ... ADDRESS_MEMORY_HIGH_END:
-					result = m_high.at(address.word - ADDRESS_MEMORY_HIGH_BEGIN);
+
+					if(MEMORY_BANKED(m_bank, address.word)) {
+						result = m_extended[MEMORY_BANK_OFFSET(m_bank, address.word)];
+					} else {
+						result = m_high[address.word - ADDRESS_MEMORY_HIGH_BEGIN];
+					}
 					break;
 				case ADDRESS_MEMORY_STACK_BEGIN ... ADDRESS_MEMORY_STACK_END:
-					result = m_stack.at(address.word - ADDRESS_MEMORY_STACK_BEGIN);
+					result = m_stack[address.word - ADDRESS_MEMORY_STACK_BEGIN];
 					break;
 				case ADDRESS_MEMORY_ZERO_PAGE_BEGIN ... ADDRESS_MEMORY_ZERO_PAGE_END:
-					result = m_zero_page.at(address.word - ADDRESS_MEMORY_ZERO_PAGE_BEGIN);
+					result = m_zero_page[address.word - ADDRESS_MEMORY_ZERO_PAGE_BEGIN];
 					break;
 				default:
 					THROW_C65_SYSTEM_MEMORY_EXCEPTION_FORMAT(C65_SYSTEM_MEMORY_EXCEPTION_ADDRESS_INVALID,
@@ -95,6 +134,8 @@ namespace c65 {
 
 			TRACE_MESSAGE(LEVEL_INFORMATION, "Memory uninitializing");
 
+			m_bank = 0;
+			m_extended.clear();
 			m_high.clear();
 			m_stack.clear();
 			m_zero_page.clear();
@@ -114,13 +155,18 @@ namespace c65 {
 
 			switch(address.word) {
 				case ADDRESS_MEMORY_HIGH_BEGIN ... ADDRESS_MEMORY_HIGH_END:
-					m_high.at(address.word - ADDRESS_MEMORY_HIGH_BEGIN) = value;
+
+					if(MEMORY_BANKED(m_bank, address.word)) {
+						m_extended[MEMORY_BANK_OFFSET(m_bank, address.word)] = value;
+					} else {
+						m_high[address.word - ADDRESS_MEMORY_HIGH_BEGIN] = value;
+					}
 					break;
 				case ADDRESS_MEMORY_STACK_BEGIN ... ADDRESS_MEMORY_STACK_END:
-					m_stack.at(address.word - ADDRESS_MEMORY_STACK_BEGIN) = value;
+					m_stack[address.word - ADDRESS_MEMORY_STACK_BEGIN] = value;
 					break;
 				case ADDRESS_MEMORY_ZERO_PAGE_BEGIN ... ADDRESS_MEMORY_ZERO_PAGE_END:
-					m_zero_page.at(address.word - ADDRESS_MEMORY_ZERO_PAGE_BEGIN) = value;
+					m_zero_page[address.word - ADDRESS_MEMORY_ZERO_PAGE_BEGIN] = value;
 					break;
 				default:
 					THROW_C65_SYSTEM_MEMORY_EXCEPTION_FORMAT(C65_SYSTEM_MEMORY_EXCEPTION_ADDRESS_INVALID,
@@ -129,5 +175,31 @@ namespace c65 {
 
 			TRACE_EXIT();
 		}
+
+		c65_byte_t
+		memory::read_bank(void) const
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT_FORMAT("Result=%u(%02x)", m_bank, m_bank);
+			return m_bank;
+		}
+
+		void
+		memory::write_bank(
+			__in c65_byte_t bank
+			)
+		{
+			TRACE_ENTRY_FORMAT("Bank=%u(%02x)", bank, bank);
+
+			TRACE_MESSAGE_FORMAT(LEVEL_VERBOSE, "Memory bank", "%u(%02x)", bank, bank);
+
+			if(bank && m_extended.empty()) {
+				m_extended.resize(MEMORY_BANK_COUNT * MEMORY_BANK_LENGTH, MEMORY_FILL);
+			}
+
+			m_bank = bank;
+
+			TRACE_EXIT();
+		}
 	}
 }
@@ -46,6 +46,12 @@ namespace c65 {
 			(((_TYPE_) > C65_SYSTEM_MEMORY_EXCEPTION_MAX) ? STRING_UNKNOWN : \
 				STRING(C65_SYSTEM_MEMORY_EXCEPTION_STR[_TYPE_]))
 
+		#define MEMORY_BANKED(_BANK_, _ADDRESS_) \
+			((_BANK_) && ((_ADDRESS_) >= ADDRESS_MEMORY_BANK_BEGIN) && ((_ADDRESS_) <= ADDRESS_MEMORY_BANK_END))
+
+		#define MEMORY_BANK_OFFSET(_BANK_, _ADDRESS_) \
+			((((_BANK_) - 1) * MEMORY_BANK_LENGTH) + ((_ADDRESS_) - ADDRESS_MEMORY_BANK_BEGIN))
+
 		#define THROW_C65_SYSTEM_MEMORY_EXCEPTION(_EXCEPT_) \
 			THROW_C65_SYSTEM_MEMORY_EXCEPTION_FORMAT(_EXCEPT_, "", "")
 		#define THROW_C65_SYSTEM_MEMORY_EXCEPTION_FORMAT(_EXCEPT_, _FORMAT_, ...) \
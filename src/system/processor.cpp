@@ -25,6 +25,12 @@ namespace c65 {
 
 		processor::processor(void) :
 			m_accumulator({}),
+			m_block(UINT16_MAX + 1, block_t()),
+			m_block_cover(UINT16_MAX + 1, DECODE_GENERATION_INVALID),
+			m_decode(UINT16_MAX + 1, decode_t()),
+			m_elapsed(0),
+			m_engine(C65_ENGINE_INTERPRETER),
+			m_generation(DECODE_GENERATION_RESET),
 			m_index_x({}),
 			m_index_y({}),
 			m_interrupt(INTERRUPT_NONE),
@@ -32,11 +38,14 @@ namespace c65 {
 			m_non_maskable({}),
 			m_program_counter({}),
 			m_reset({}),
+			m_result(RESULT(false, false)),
 			m_stack(STACK_NONE),
 			m_stack_pointer({}),
 			m_status({}),
 			m_stop(false),
-			m_wait(false)
+			m_timing(C65_TIMING_FAST),
+			m_wait(false),
+			m_write(0)
 		{
 			TRACE_ENTRY();
 			TRACE_EXIT();
@@ -48,6 +57,157 @@ namespace c65 {
 			TRACE_EXIT();
 		}
 
+		processor::cycle_bus::cycle_bus(
+			__in c65::interface::bus &bus
+			) :
+				m_access(0),
+				m_always(false),
+				m_bus(bus),
+				m_data(0),
+				m_idle({}),
+				m_index(0),
+				m_indexed(false),
+				m_modify(false),
+				m_request(0)
+		{
+			TRACE_ENTRY_FORMAT("Bus=%p", &bus);
+
+			m_subscription = bus.subscription();
+			TRACE_EXIT();
+		}
+
+		processor::cycle_bus::~cycle_bus(void)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT();
+		}
+
+		uint32_t
+		processor::cycle_bus::access(void) const
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT_FORMAT("Result=%u", m_access);
+			return m_access;
+		}
+
+		void
+		processor::cycle_bus::idle(
+			__in c65_address_t address,
+			__in uint8_t count
+			) const
+		{
+			TRACE_ENTRY_FORMAT("Address=%u(%04x), Count=%u", address.word, address.word, count);
+
+			for(; count; --count) {
+				m_bus.read(address);
+				++m_access;
+			}
+
+			TRACE_EXIT();
+		}
+
+		void
+		processor::cycle_bus::index(
+			__in c65_address_t address,
+			__in c65_byte_t index,
+			__in uint32_t access,
+			__in bool always
+			)
+		{
+			TRACE_ENTRY_FORMAT("Address=%u(%04x), Index=%u(%02x), Access=%u, Always=%x", address.word, address.word,
+				index, index, access, always);
+
+			m_always = always;
+			m_data = (m_request + access);
+			m_idle = address;
+			m_index = index;
+			m_indexed = true;
+
+			TRACE_EXIT();
+		}
+
+		void
+		processor::cycle_bus::modify(void)
+		{
+			TRACE_ENTRY();
+
+			m_modify = true;
+
+			TRACE_EXIT();
+		}
+
+		void
+		processor::cycle_bus::on_notify(
+			__in const c65_event_t &event
+			) const
+		{
+			TRACE_ENTRY_FORMAT("Event=%p", &event);
+
+			m_bus.notify(event.type, event.address, event.data.word);
+
+			TRACE_EXIT();
+		}
+
+		c65_byte_t
+		processor::cycle_bus::on_read(
+			__in c65_address_t address
+			) const
+		{
+			c65_byte_t result;
+
+			TRACE_ENTRY_FORMAT("Address=%u(%04x)", address.word, address.word);
+
+			schedule(address);
+			result = m_bus.read(address);
+			++m_access;
+
+			TRACE_EXIT_FORMAT("Result=%u(%02x)", result, result);
+			return result;
+		}
+
+		void
+		processor::cycle_bus::on_write(
+			__in c65_address_t address,
+			__in c65_byte_t value
+			)
+		{
+			TRACE_ENTRY_FORMAT("Address=%u(%04x), Value=%u(%02x)", address.word, address.word, value, value);
+
+			schedule(address);
+
+			// read-modify-write instructions re-read their target before writing it back
+			if(m_modify) {
+				idle(address);
+			}
+
+			m_bus.write(address, value);
+			++m_access;
+
+			TRACE_EXIT();
+		}
+
+		void
+		processor::cycle_bus::schedule(
+			__in c65_address_t address
+			) const
+		{
+			TRACE_ENTRY_FORMAT("Address=%u(%04x)", address.word, address.word);
+
+			// indexed accesses spend an internal cycle when the index carries into the high byte, or always for stores
+			if(m_indexed && (m_request == m_data)) {
+				c65_address_t base;
+
+				base.word = (address.word - m_index);
+				if(m_always || (base.high != address.high)) {
+					idle(m_idle);
+				}
+			}
+
+			++m_request;
+
+			TRACE_EXIT();
+		}
+
 		void
 		processor::add_carry(
 			__in uint8_t value
@@ -57,35 +217,165 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Value=%u(%02x)", value, value);
 
-			if(m_status.decimal_mode) {
-				// TODO
-			}
-
 			sum = (m_accumulator.low + value + m_status.carry);
 
 			m_status.carry = (sum > UINT8_MAX);
 			m_status.overflow = MASK_CHECK(((m_accumulator.low ^ sum) & (value ^ sum) & MASK(FLAG_NEGATIVE)), FLAG_NEGATIVE);
 			m_accumulator.low = sum;
-			m_status.zero = !m_accumulator.low;
-			m_status.negative = MASK_CHECK(m_accumulator.low, FLAG_NEGATIVE);
+			m_result = m_accumulator.low;
+
+			TRACE_EXIT();
+		}
+
+		void
+		processor::add_decimal(
+			__in uint8_t value,
+			__in bool subtract
+			)
+		{
+			c65_word_t entry;
+
+			TRACE_ENTRY_FORMAT("Value=%u(%02x), Subtract=%x", value, value, subtract);
+
+			entry = DECIMAL[DECIMAL_INDEX(subtract, m_status.carry, m_accumulator.low, value)];
+			m_status.carry = BIT_CHECK(entry, DECIMAL_CARRY);
+			m_status.overflow = BIT_CHECK(entry, DECIMAL_OVERFLOW);
+			m_accumulator.low = entry;
+			m_result = m_accumulator.low;
 
 			TRACE_EXIT();
 		}
 
-		c65_address_t
+		std::vector<c65_word_t>
+		processor::decimal_table(void)
+		{
+			int accumulator, carry, subtract, value;
+			std::vector<c65_word_t> result(DECIMAL_LENGTH, 0);
+
+			TRACE_ENTRY();
+
+			for(subtract = 0; subtract <= 1; ++subtract) {
+
+				for(carry = 0; carry <= 1; ++carry) {
+
+					for(accumulator = 0; accumulator <= UINT8_MAX; ++accumulator) {
+
+						for(value = 0; value <= UINT8_MAX; ++value) {
+							int low, sum;
+							bool carry_out, overflow;
+
+							if(subtract) {
+								low = ((accumulator & 0x0f) - (value & 0x0f) + carry - 1);
+								sum = (accumulator - value + carry - 1);
+								overflow = MASK_CHECK((accumulator ^ value) & (accumulator ^ sum) & MASK(FLAG_NEGATIVE), FLAG_NEGATIVE);
+								carry_out = (sum >= 0);
+
+								if(sum < 0) {
+									sum -= 0x60;
+								}
+
+								if(low < 0) {
+									sum -= 0x06;
+								}
+							} else {
+								low = ((accumulator & 0x0f) + (value & 0x0f) + carry);
+								if(low >= 0x0a) {
+									low = (((low + 0x06) & 0x0f) + 0x10);
+								}
+
+								sum = ((int8_t)(accumulator & 0xf0) + (int8_t)(value & 0xf0) + low);
+								overflow = ((sum < INT8_MIN) || (sum > INT8_MAX));
+
+								sum = ((accumulator & 0xf0) + (value & 0xf0) + low);
+								if(sum >= 0xa0) {
+									sum += 0x60;
+								}
+
+								carry_out = (sum > UINT8_MAX);
+							}
+
+							result[DECIMAL_INDEX(subtract, carry, accumulator, value)] = ((sum & UINT8_MAX)
+								| (carry_out ? DECIMAL_CARRY : 0) | (overflow ? DECIMAL_OVERFLOW : 0));
+						}
+					}
+				}
+			}
+
+			TRACE_EXIT();
+			return result;
+		}
+
+		const processor::decode_t &
+		processor::decode(
+			__in c65::interface::bus &bus,
+			__in c65_address_t address
+			)
+		{
+			TRACE_ENTRY_FORMAT("Bus=%p, Address=%u(%04x)", &bus, address.word, address.word);
+
+			decode_t &result = m_decode[address.word];
+			if(result.generation != m_generation) {
+				uint8_t attribute;
+				uint32_t begin = address.word, end;
+				c65_address_t first = address, last;
+
+				result.opcode = read_byte(bus, address);
+				const instruction_t &instruction = INSTRUCTION(result.opcode);
+
+				++address.word;
+
+				// under exact timing the handler fetches its own operand, in bus order
+				switch((m_timing == C65_TIMING_EXACT) ? (uint8_t)INSTRUCTION_LENGTH_NONE : instruction.length) {
+					case INSTRUCTION_LENGTH_BYTE:
+						result.operand = read_byte(bus, address);
+
+						TRACE_MESSAGE_FORMAT(LEVEL_VERBOSE, "Operand", "[%04x] %u(%02x)", address.word,
+							result.operand, result.operand);
+						break;
+					case INSTRUCTION_LENGTH_WORD:
+						result.operand = read_word(bus, address);
+
+						TRACE_MESSAGE_FORMAT(LEVEL_VERBOSE, "Operand", "[%04x] %u(%04x)", address.word,
+							result.operand, result.operand);
+						break;
+					default:
+						result.operand = 0;
+						break;
+				}
+
+				end = (begin + instruction.length);
+
+				last.word = (first.word + instruction.length);
+				attribute = (bus.attribute(first) | bus.attribute(last));
+				result.handler = (MASK_CHECK(attribute, C65_ATTRIBUTE_NO_EXECUTE) ? &processor::execute_fault
+							: HANDLER[m_timing][result.opcode]);
+
+				// instructions overlapping the key/random registers change without a bus write, so they are never cached,
+				// nor is anything under exact timing, where every fetch is a bus cycle, on no-execute/mmio pages, or on pages
+				// read through a handler
+				result.generation = ((((begin <= ADDRESS_KEY) && (end >= ADDRESS_RANDOM)) || (m_timing == C65_TIMING_EXACT)
+							|| MASK_CHECK(attribute, C65_ATTRIBUTE_NO_EXECUTE) || MASK_CHECK(attribute, C65_ATTRIBUTE_MMIO)
+							|| !bus.cacheable(first) || !bus.cacheable(last))
+							? DECODE_GENERATION_INVALID : m_generation);
+			}
+
+			TRACE_EXIT_FORMAT("Result=%p", &result);
+			return result;
+		}
+
+		template <int MODE> c65_address_t
 		processor::effective_address(
 			__in c65::interface::bus &bus,
 			__in c65_word_t indirect,
-			__in int mode,
 			__inout uint8_t &cycle
 			)
 		{
 			c65_address_t result = {};
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Indirect=%u(%04x), Mode=%i(%s) Cycles=%u", &bus, indirect, indirect,
-				mode, INSTRUCTION_MODE_STRING(mode), cycle);
+				MODE, INSTRUCTION_MODE_STRING(MODE), cycle);
 
-			switch(mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 					result.word = indirect;
 					break;
@@ -147,7 +437,7 @@ namespace c65 {
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s)", mode, INSTRUCTION_MODE_STRING(mode));
+						"%u(%s)", MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
 			TRACE_EXIT_FORMAT("Result=%u(%04x)", result.word, result.word);
@@ -159,211 +449,59 @@ namespace c65 {
 			__in c65::interface::bus &bus
 			)
 		{
-			c65_address_t address;
-			c65_word_t operand = 0;
-			uint8_t opcode, result = 0;
+			uint8_t result;
 
 			TRACE_ENTRY_FORMAT("Bus=%p", &bus);
 
-			address = m_program_counter;
-			opcode = read_byte(bus, m_program_counter);
-			const instruction_t &instruction = INSTRUCTION(opcode);
+			const decode_t &entry = decode(bus, m_program_counter);
+			const instruction_t &instruction = INSTRUCTION(entry.opcode);
 
 			TRACE_MESSAGE_FORMAT(LEVEL_VERBOSE, "Opcode", "[%04x] %s %s", m_program_counter.word, INSTRUCTION_STRING(instruction.type),
 				INSTRUCTION_MODE_STRING(instruction.mode));
 
-			++m_program_counter.word;
+			result = (this->*entry.handler)(bus, instruction, entry.operand);
 
-			switch(instruction.length) {
-				case INSTRUCTION_LENGTH_BYTE:
-					operand = read_byte(bus, m_program_counter);
+			TRACE_EXIT_FORMAT("Result=%u", result);
+			return result;
+		}
 
-					TRACE_MESSAGE_FORMAT(LEVEL_VERBOSE, "Operand", "[%04x] %u(%02x)", m_program_counter.word,
-						operand, operand);
-					break;
-				case INSTRUCTION_LENGTH_WORD:
-					operand = read_word(bus, m_program_counter);
+		uint32_t
+		processor::execute_block(
+			__in c65::interface::bus &bus
+			)
+		{
+			uint8_t cycle;
+			uint32_t result = 0;
 
-					TRACE_MESSAGE_FORMAT(LEVEL_VERBOSE, "Operand", "[%04x] %u(%04x)", m_program_counter.word,
-						operand, operand);
-					break;
-				default:
-					break;
-			}
+			TRACE_ENTRY_FORMAT("Bus=%p", &bus);
 
-			m_program_counter.word += instruction.length;
-			result = instruction.cycle;
+			const block_t &block = translate(bus);
+			if(!block.entry.empty()) {
 
-			switch(instruction.type) {
-				case INSTRUCTION_ADC:
-					result += execute_add(bus, instruction, operand);
-					break;
-				case INSTRUCTION_AND:
-					result += execute_and(bus, instruction, operand);
-					break;
-				case INSTRUCTION_ASL:
-					result += execute_shift_left(bus, instruction, operand);
-					break;
-				case INSTRUCTION_BBR0 ... INSTRUCTION_BBR7:
-				case INSTRUCTION_BBS0 ... INSTRUCTION_BBS7:
-					result += execute_branch_bit(bus, instruction, operand);
-					break;
-				case INSTRUCTION_BCC:
-				case INSTRUCTION_BCS:
-				case INSTRUCTION_BEQ:
-				case INSTRUCTION_BMI:
-				case INSTRUCTION_BNE:
-				case INSTRUCTION_BPL:
-				case INSTRUCTION_BRA:
-				case INSTRUCTION_BVC:
-				case INSTRUCTION_BVS:
-					result += execute_branch(bus, instruction, operand);
-					break;
-				case INSTRUCTION_BIT:
-					result += execute_bit(bus, instruction, operand);
-					break;
-				case INSTRUCTION_BRK:
-					bus.notify(C65_EVENT_BREAKPOINT, address);
-					result += execute_break(bus, instruction);
-					break;
-				case INSTRUCTION_CLC:
-				case INSTRUCTION_CLD:
-				case INSTRUCTION_CLI:
-				case INSTRUCTION_CLV:
-					result += execute_clear(instruction);
-					break;
-				case INSTRUCTION_CMP:
-					result += execute_compare(bus, instruction, operand);
-					break;
-				case INSTRUCTION_CPX:
-					result += execute_compare_index_x(bus, instruction, operand);
-					break;
-				case INSTRUCTION_CPY:
-					result += execute_compare_index_y(bus, instruction, operand);
-					break;
-				case INSTRUCTION_DEC:
-					result += execute_decrement(bus, instruction, operand);
-					break;
-				case INSTRUCTION_DEX:
-				case INSTRUCTION_DEY:
-					result += execute_decrement_index(instruction);
-					break;
-				case INSTRUCTION_EOR:
-					result += execute_xor(bus, instruction, operand);
-					break;
-				case INSTRUCTION_INC:
-					result += execute_increment(bus, instruction, operand);
-					break;
-				case INSTRUCTION_INX:
-				case INSTRUCTION_INY:
-					result += execute_increment_index(instruction);
-					break;
-				case INSTRUCTION_JMP:
-					result += execute_jump(bus, instruction, operand);
-					break;
-				case INSTRUCTION_JSR:
-					result += execute_jump_subroutine(bus, instruction, operand);
-					break;
-				case INSTRUCTION_LDA:
-					result += execute_load_accumulator(bus, instruction, operand);
-					break;
-				case INSTRUCTION_LDX:
-					result += execute_load_index_x(bus, instruction, operand);
-					break;
-				case INSTRUCTION_LDY:
-					result += execute_load_index_y(bus, instruction, operand);
-					break;
-				case INSTRUCTION_LSR:
-					result += execute_shift_right(bus, instruction, operand);
-					break;
-				case INSTRUCTION_ORA:
-					result += execute_or(bus, instruction, operand);
-					break;
-				case INSTRUCTION_PHA:
-				case INSTRUCTION_PHP:
-				case INSTRUCTION_PHX:
-				case INSTRUCTION_PHY:
-					result += execute_push(bus, instruction);
-					break;
-				case INSTRUCTION_PLA:
-				case INSTRUCTION_PLP:
-				case INSTRUCTION_PLX:
-				case INSTRUCTION_PLY:
-					result += execute_pull(bus, instruction);
-					break;
-				case INSTRUCTION_RMB0 ... INSTRUCTION_RMB7:
-					result += execute_reset_bit(bus, instruction, operand);
-					break;
-				case INSTRUCTION_ROL:
-					result += execute_rotate_left(bus, instruction, operand);
-					break;
-				case INSTRUCTION_ROR:
-					result += execute_rotate_right(bus, instruction, operand);
-					break;
-				case INSTRUCTION_RTI:
-					result += execute_return_interrupt(bus, instruction);
-					break;
-				case INSTRUCTION_RTS:
-					result += execute_return_subroutine(bus, instruction);
-					break;
-				case INSTRUCTION_SBC:
-					result += execute_subtract(bus, instruction, operand);
-					break;
-				case INSTRUCTION_SEC:
-				case INSTRUCTION_SED:
-				case INSTRUCTION_SEI:
-					result += execute_set(instruction);
-					break;
-				case INSTRUCTION_SMB0 ... INSTRUCTION_SMB7:
-					result += execute_set_bit(bus, instruction, operand);
-					break;
-				case INSTRUCTION_STA:
-					result += execute_store_accumulator(bus, instruction, operand);
-					break;
-				case INSTRUCTION_STP:
-					result += execute_stop(bus, instruction);
-					break;
-				case INSTRUCTION_STX:
-					result += execute_store_index_x(bus, instruction, operand);
-					break;
-				case INSTRUCTION_STY:
-					result += execute_store_index_y(bus, instruction, operand);
-					break;
-				case INSTRUCTION_STZ:
-					result += execute_store_zero(bus, instruction, operand);
-					break;
-				case INSTRUCTION_TAX:
-				case INSTRUCTION_TAY:
-				case INSTRUCTION_TSX:
-				case INSTRUCTION_TXA:
-				case INSTRUCTION_TXS:
-				case INSTRUCTION_TYA:
-					result += execute_transfer(instruction);
-					break;
-				case INSTRUCTION_TRB:
-					result += execute_test_reset_bit(bus, instruction, operand);
-					break;
-				case INSTRUCTION_TSB:
-					result += execute_test_set_bit(bus, instruction, operand);
-					break;
-				case INSTRUCTION_WAI:
-					result += execute_wait(bus, instruction);
-					break;
-				default:
+				for(const decode_t &entry : block.entry) {
+					const instruction_t &instruction = INSTRUCTION(entry.opcode);
 
-					if(instruction.mode != INSTRUCTION_MODE_IMPLIED) {
-						bus.notify(C65_EVENT_ILLEGAL_INSTRUCTION, address, opcode);
-					}
+					TRACE_MESSAGE_FORMAT(LEVEL_VERBOSE, "Opcode", "[%04x] %s %s", m_program_counter.word,
+						INSTRUCTION_STRING(instruction.type), INSTRUCTION_MODE_STRING(instruction.mode));
 
-					result += execute_no_operation(instruction);
-					break;
+					cycle = (this->*entry.handler)(bus, instruction, entry.operand);
+					result += cycle;
+					m_elapsed += cycle;
+
+					// a write into the running block flushes it, so the remaining entries may be stale
+					if(block.generation != m_generation) {
+						break;
+					}
+				}
+			} else {
+				result = execute(bus);
 			}
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_add(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -375,7 +513,7 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_Y:
@@ -384,24 +522,29 @@ namespace c65 {
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDIRECT:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDIRECT_INDEX:
-					value = read_byte(bus, effective_address(bus, operand, instruction.mode, result));
+					value = read_byte(bus, effective_address<MODE>(bus, operand, result));
 					break;
 				case INSTRUCTION_MODE_IMMEDIATE:
 					value = operand;
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
-			add_carry(value);
+			if(m_status.decimal_mode) {
+				add_decimal(value, false);
+				result += CYCLE_DECIMAL;
+			} else {
+				add_carry(value);
+			}
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_and(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -413,7 +556,7 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_Y:
@@ -422,27 +565,26 @@ namespace c65 {
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDIRECT:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDIRECT_INDEX:
-					value = read_byte(bus, effective_address(bus, operand, instruction.mode, result));
+					value = read_byte(bus, effective_address<MODE>(bus, operand, result));
 					break;
 				case INSTRUCTION_MODE_IMMEDIATE:
 					value = operand;
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
 			value = (m_accumulator.low & value);
 			m_accumulator.low = value;
-			m_status.zero = !value;
-			m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			m_result = value;
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_bit(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -454,31 +596,30 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
-					value = read_byte(bus, effective_address(bus, operand, instruction.mode, result));
+					value = read_byte(bus, effective_address<MODE>(bus, operand, result));
 					break;
 				case INSTRUCTION_MODE_IMMEDIATE:
 					value = operand;
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
-			m_status.zero = !BIT_CHECK(m_accumulator.low, value);
 			m_status.overflow = MASK_CHECK(value, FLAG_OVERFLOW);
-			m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			m_result = RESULT(!BIT_CHECK(m_accumulator.low, value), MASK_CHECK(value, FLAG_NEGATIVE));
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_branch(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -490,7 +631,7 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.type) {
+			switch(TYPE) {
 				case INSTRUCTION_BCC:
 					taken = !m_status.carry;
 					break;
@@ -498,16 +639,16 @@ namespace c65 {
 					taken = m_status.carry;
 					break;
 				case INSTRUCTION_BEQ:
-					taken = m_status.zero;
+					taken = RESULT_ZERO_CHECK(m_result);
 					break;
 				case INSTRUCTION_BMI:
-					taken = m_status.negative;
+					taken = RESULT_NEGATIVE_CHECK(m_result);
 					break;
 				case INSTRUCTION_BNE:
-					taken = !m_status.zero;
+					taken = !RESULT_ZERO_CHECK(m_result);
 					break;
 				case INSTRUCTION_BPL:
-					taken = !m_status.negative;
+					taken = !RESULT_NEGATIVE_CHECK(m_result);
 					break;
 				case INSTRUCTION_BRA:
 					taken = true;
@@ -520,13 +661,13 @@ namespace c65 {
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_INVALID,
-						"%u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type));
+						"%u(%s)", TYPE, INSTRUCTION_STRING(TYPE));
 			}
 
 			if(taken) {
 				c65_address_t address;
 
-				address = effective_address(bus, operand, instruction.mode, result);
+				address = effective_address<MODE>(bus, operand, result);
 				result += CYCLE_BRANCH_TAKEN;
 				m_program_counter.word = address.word;
 			}
@@ -535,7 +676,7 @@ namespace c65 {
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_branch_bit(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -548,18 +689,15 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			address = effective_address(bus, operand, instruction.mode, result);
+			address = effective_address<MODE>(bus, operand, result);
 
-			switch(instruction.type) {
-				case INSTRUCTION_BBR0 ... INSTRUCTION_BBR7:
-					taken = !MASK_CHECK(read_byte(bus, address), instruction.type - INSTRUCTION_BBR0);
-					break;
-				case INSTRUCTION_BBS0 ... INSTRUCTION_BBS7:
-					taken = MASK_CHECK(read_byte(bus, address), instruction.type - INSTRUCTION_BBS0);
-					break;
-				default:
-					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_INVALID,
-						"%u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type));
+			if constexpr((TYPE >= INSTRUCTION_BBR0) && (TYPE <= INSTRUCTION_BBR7)) {
+				taken = !MASK_CHECK(read_byte(bus, address), TYPE - INSTRUCTION_BBR0);
+			} else if constexpr((TYPE >= INSTRUCTION_BBS0) && (TYPE <= INSTRUCTION_BBS7)) {
+				taken = MASK_CHECK(read_byte(bus, address), TYPE - INSTRUCTION_BBS0);
+			} else {
+				THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_INVALID,
+					"%u(%s)", TYPE, INSTRUCTION_STRING(TYPE));
 			}
 
 			if(taken) {
@@ -570,32 +708,38 @@ namespace c65 {
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_break(
 			__in c65::interface::bus &bus,
-			__in const instruction_t &instruction
+			__in const instruction_t &instruction,
+			__in c65_word_t operand
 			)
 		{
 			uint8_t result = 0;
+			c65_address_t address;
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p", &bus, &instruction);
 
+			address.word = (m_program_counter.word - (INSTRUCTION_MODE_LENGTH(MODE) + 1));
+			bus.notify(C65_EVENT_BREAKPOINT, address);
 			service_interrupt(bus, m_maskable, true);
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_clear(
-			__in const instruction_t &instruction
+			__in c65::interface::bus &bus,
+			__in const instruction_t &instruction,
+			__in c65_word_t operand
 			)
 		{
 			uint8_t result = 0;
 
 			TRACE_ENTRY_FORMAT("Instruction=%p", &instruction);
 
-			switch(instruction.type) {
+			switch(TYPE) {
 				case INSTRUCTION_CLC:
 					m_status.carry = false;
 					break;
@@ -610,14 +754,14 @@ namespace c65 {
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_INVALID,
-						"%u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type));
+						"%u(%s)", TYPE, INSTRUCTION_STRING(TYPE));
 			}
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_compare(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -629,7 +773,7 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_Y:
@@ -638,26 +782,25 @@ namespace c65 {
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDIRECT:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDIRECT_INDEX:
-					value = read_byte(bus, effective_address(bus, operand, instruction.mode, result));
+					value = read_byte(bus, effective_address<MODE>(bus, operand, result));
 					break;
 				case INSTRUCTION_MODE_IMMEDIATE:
 					value = operand;
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
 			m_status.carry = (m_accumulator.low >= value);
-			m_status.zero = (m_accumulator.low == value);
-			m_status.negative = MASK_CHECK((m_accumulator.low - value) & UINT8_MAX, FLAG_NEGATIVE);
+			m_result = ((m_accumulator.low - value) & UINT8_MAX);
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_compare_index_x(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -669,29 +812,28 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ZERO_PAGE:
-					value = read_byte(bus, effective_address(bus, operand, instruction.mode, result));
+					value = read_byte(bus, effective_address<MODE>(bus, operand, result));
 					break;
 				case INSTRUCTION_MODE_IMMEDIATE:
 					value = operand;
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
 			m_status.carry = (m_index_x.low >= value);
-			m_status.zero = (m_index_x.low == value);
-			m_status.negative = MASK_CHECK((m_index_x.low - value) & UINT8_MAX, FLAG_NEGATIVE);
+			m_result = ((m_index_x.low - value) & UINT8_MAX);
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_compare_index_y(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -703,29 +845,28 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ZERO_PAGE:
-					value = read_byte(bus, effective_address(bus, operand, instruction.mode, result));
+					value = read_byte(bus, effective_address<MODE>(bus, operand, result));
 					break;
 				case INSTRUCTION_MODE_IMMEDIATE:
 					value = operand;
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
 			m_status.carry = (m_index_y.low >= value);
-			m_status.zero = (m_index_y.low == value);
-			m_status.negative = MASK_CHECK((m_index_y.low - value) & UINT8_MAX, FLAG_NEGATIVE);
+			m_result = ((m_index_y.low - value) & UINT8_MAX);
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_decrement(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -738,12 +879,12 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
-					address = effective_address(bus, operand, instruction.mode, result);
+					address = effective_address<MODE>(bus, operand, result);
 					value = read_byte(bus, address);
 					write_byte(bus, address, --value);
 					result += CYCLE_READ_MODIFY_WRITE;
@@ -753,20 +894,21 @@ namespace c65 {
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
-			m_status.zero = !value;
-			m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			m_result = value;
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_decrement_index(
-			__in const instruction_t &instruction
+			__in c65::interface::bus &bus,
+			__in const instruction_t &instruction,
+			__in c65_word_t operand
 			)
 		{
 			uint8_t result = 0;
@@ -774,7 +916,7 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Instruction=%p", &instruction);
 
-			switch(instruction.type) {
+			switch(TYPE) {
 				case INSTRUCTION_DEX:
 					value = --m_index_x.low;
 					break;
@@ -783,17 +925,167 @@ namespace c65 {
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_INVALID,
-						"%u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type));
+						"%u(%s)", TYPE, INSTRUCTION_STRING(TYPE));
 			}
 
-			m_status.zero = !value;
-			m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			m_result = value;
+
+			TRACE_EXIT_FORMAT("Result=%u", result);
+			return result;
+		}
+
+		template <uint8_t OPCODE> uint8_t
+		processor::execute_exact(
+			__in c65::interface::bus &bus,
+			__in const instruction_t &instruction
+			)
+		{
+			uint8_t result;
+			cycle_bus cycle(bus);
+			c65_word_t operand = 0;
+			c65_address_t address = m_program_counter, idle;
+			constexpr handler_t entry = handler<OPCODE>();
+			constexpr int TYPE = instruction_traits<OPCODE>::type, MODE = instruction_traits<OPCODE>::mode;
+			constexpr uint8_t LENGTH = instruction_traits<OPCODE>::length;
+
+			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p", &bus, &instruction);
+
+			// the opcode was fetched by decode and the operand follows it, except for the jsr high byte and the bbr/bbs offset,
+			// which come after the stack and data cycles
+			if constexpr(LENGTH != INSTRUCTION_LENGTH_NONE) {
+				++address.word;
+				operand = read_byte(cycle, address);
+			}
+
+			if constexpr((LENGTH == INSTRUCTION_LENGTH_WORD) && (TYPE != INSTRUCTION_JSR) && (MODE != INSTRUCTION_MODE_ZERO_PAGE_RELATIVE)) {
+				++address.word;
+				operand |= (read_byte(cycle, address) << CHAR_BIT);
+			}
+
+			m_program_counter.word += (LENGTH + 1);
+
+			// internal cycles re-read the last instruction byte, or the byte following a single-byte instruction
+			idle.word = (m_program_counter.word - ((LENGTH != INSTRUCTION_LENGTH_NONE) ? 1 : 0));
+
+			if constexpr(TYPE == INSTRUCTION_JSR) {
+				cycle.idle(m_stack_pointer);
+				push_word(cycle, m_program_counter.word - 1);
+				++address.word;
+				operand |= (read_byte(cycle, address) << CHAR_BIT);
+				m_program_counter.word = operand;
+				bus.notify(C65_EVENT_SUBROUTINE_ENTRY, m_program_counter);
+			} else if constexpr(MODE == INSTRUCTION_MODE_ZERO_PAGE_RELATIVE) {
+				bool taken;
+				c65_byte_t value;
+				c65_address_t target = {};
+
+				target.low = operand;
+				value = read_byte(cycle, target);
+				cycle.idle(target);
+				++address.word;
+				operand = read_byte(cycle, address);
+
+				if constexpr((TYPE >= INSTRUCTION_BBR0) && (TYPE <= INSTRUCTION_BBR7)) {
+					taken = !MASK_CHECK(value, TYPE - INSTRUCTION_BBR0);
+				} else {
+					taken = MASK_CHECK(value, TYPE - INSTRUCTION_BBS0);
+				}
+
+				if(taken) {
+					target.word = (m_program_counter.word + (int8_t)operand);
+					cycle.idle(idle, (target.high != m_program_counter.high) ? 2 : 1);
+					m_program_counter = target;
+				}
+			} else {
+				uint8_t extra;
+				c65_address_t target = {};
+
+				if constexpr((MODE == INSTRUCTION_MODE_ABSOLUTE_INDEX_INDIRECT) || (MODE == INSTRUCTION_MODE_ABSOLUTE_INDIRECT)
+						|| (MODE == INSTRUCTION_MODE_ACCUMULATOR) || (MODE == INSTRUCTION_MODE_IMPLIED)
+						|| (MODE == INSTRUCTION_MODE_RETURN) || (MODE == INSTRUCTION_MODE_STACK) || (MODE == INSTRUCTION_MODE_STATE)
+						|| (MODE == INSTRUCTION_MODE_ZERO_PAGE_INDEX_INDIRECT) || (MODE == INSTRUCTION_MODE_ZERO_PAGE_INDEX_X)
+						|| (MODE == INSTRUCTION_MODE_ZERO_PAGE_INDEX_Y) || (MODE == INSTRUCTION_MODE_ILLEGAL_NOP_3)) {
+					cycle.idle(idle);
+				}
+
+				// pulls spend a cycle on the current stack slot before incrementing the stack pointer
+				if constexpr((MODE == INSTRUCTION_MODE_RETURN) || (TYPE == INSTRUCTION_PLA) || (TYPE == INSTRUCTION_PLP)
+						|| (TYPE == INSTRUCTION_PLX) || (TYPE == INSTRUCTION_PLY)) {
+					cycle.idle(m_stack_pointer);
+				}
+
+				if constexpr((MODE == INSTRUCTION_MODE_ABSOLUTE_INDEX_X) || (MODE == INSTRUCTION_MODE_ABSOLUTE_INDEX_Y)) {
+					cycle.index(idle, (MODE == INSTRUCTION_MODE_ABSOLUTE_INDEX_X) ? m_index_x.low : m_index_y.low, 0,
+						(TYPE == INSTRUCTION_DEC) || (TYPE == INSTRUCTION_INC) || (TYPE == INSTRUCTION_STA)
+						|| (TYPE == INSTRUCTION_STZ));
+				} else if constexpr(MODE == INSTRUCTION_MODE_ZERO_PAGE_INDIRECT_INDEX) {
+					cycle.index(idle, m_index_y.low, 2, (TYPE == INSTRUCTION_STA));
+				}
+
+				if constexpr(((TYPE == INSTRUCTION_ASL) || (TYPE == INSTRUCTION_DEC) || (TYPE == INSTRUCTION_INC)
+						|| (TYPE == INSTRUCTION_LSR) || (TYPE == INSTRUCTION_ROL) || (TYPE == INSTRUCTION_ROR)
+						|| (TYPE == INSTRUCTION_TRB) || (TYPE == INSTRUCTION_TSB)
+						|| ((TYPE >= INSTRUCTION_RMB0) && (TYPE <= INSTRUCTION_RMB7))
+						|| ((TYPE >= INSTRUCTION_SMB0) && (TYPE <= INSTRUCTION_SMB7)))
+						&& (MODE != INSTRUCTION_MODE_ACCUMULATOR)) {
+					cycle.modify();
+				}
+
+				extra = (this->*entry)(cycle, instruction, operand);
+
+				if constexpr((TYPE == INSTRUCTION_ADC) || (TYPE == INSTRUCTION_SBC)) {
+
+					if(m_status.decimal_mode) {
+						cycle.idle(idle);
+					}
+				} else if constexpr(TYPE == INSTRUCTION_BRK) {
+					target.word = ADDRESS_PROCESSOR_MASKABLE_BEGIN;
+					read_word(cycle, target);
+				} else if constexpr(TYPE == INSTRUCTION_RTS) {
+					target.word = (m_program_counter.word - 1);
+					cycle.idle(target);
+				} else if constexpr(MODE == INSTRUCTION_MODE_RELATIVE) {
+					cycle.idle(idle, extra);
+				} else if constexpr(MODE == INSTRUCTION_MODE_STATE) {
+					cycle.idle(idle);
+				} else if constexpr((MODE == INSTRUCTION_MODE_ILLEGAL_NOP_2) || (MODE == INSTRUCTION_MODE_ILLEGAL_NOP_3)) {
+					target.low = (operand + ((MODE == INSTRUCTION_MODE_ILLEGAL_NOP_3) ? m_index_x.low : 0));
+					read_byte(cycle, target);
+				} else if constexpr(MODE == INSTRUCTION_MODE_ILLEGAL_NOP_4) {
+					cycle.idle(idle, 5);
+				} else if constexpr(MODE == INSTRUCTION_MODE_ILLEGAL_NOP_5) {
+					target.word = operand;
+					read_byte(cycle, target);
+				}
+			}
+
+			result = (cycle.access() + 1);
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
 		uint8_t
+		processor::execute_fault(
+			__in c65::interface::bus &bus,
+			__in const instruction_t &instruction,
+			__in c65_word_t operand
+			)
+		{
+			uint8_t result = 0;
+
+			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p", &bus, &instruction);
+
+			// fetches from a no-execute page stop the processor at the faulting instruction, until reset
+			m_stop = true;
+			bus.notify(C65_EVENT_PROTECTION_FAULT, m_program_counter, MASK(C65_ATTRIBUTE_NO_EXECUTE));
+			bus.notify(C65_EVENT_STOP_ENTRY, m_program_counter);
+
+			TRACE_EXIT_FORMAT("Result=%u", result);
+			return result;
+		}
+
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_increment(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -806,12 +1098,12 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
-					address = effective_address(bus, operand, instruction.mode, result);
+					address = effective_address<MODE>(bus, operand, result);
 					value = read_byte(bus, address);
 					write_byte(bus, address, ++value);
 					result += CYCLE_READ_MODIFY_WRITE;
@@ -821,20 +1113,21 @@ namespace c65 {
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
-			m_status.zero = !value;
-			m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			m_result = value;
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_increment_index(
-			__in const instruction_t &instruction
+			__in c65::interface::bus &bus,
+			__in const instruction_t &instruction,
+			__in c65_word_t operand
 			)
 		{
 			uint8_t result = 0;
@@ -842,7 +1135,7 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Instruction=%p", &instruction);
 
-			switch(instruction.type) {
+			switch(TYPE) {
 				case INSTRUCTION_INX:
 					value = ++m_index_x.low;
 					break;
@@ -851,18 +1144,17 @@ namespace c65 {
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_INVALID,
-						"%u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type));
+						"%u(%s)", TYPE, INSTRUCTION_STRING(TYPE));
 			}
 
-			m_status.zero = !value;
-			m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			m_result = value;
 
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_jump(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -874,17 +1166,17 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			address = effective_address(bus, operand, instruction.mode, result);
+			address = effective_address<MODE>(bus, operand, result);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_INDIRECT:
 				case INSTRUCTION_MODE_ABSOLUTE_INDIRECT:
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
 			m_program_counter.word = address.word;
@@ -893,7 +1185,7 @@ namespace c65 {
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_jump_subroutine(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -905,14 +1197,14 @@ namespace c65 {
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
 			push_word(bus, m_program_counter.word - 1);
-			m_program_counter = effective_address(bus, operand, instruction.mode, result);
+			m_program_counter = effective_address<MODE>(bus, operand, result);
 			bus.notify(C65_EVENT_SUBROUTINE_ENTRY, m_program_counter);
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_load_accumulator(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -924,7 +1216,7 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_Y:
@@ -933,26 +1225,25 @@ namespace c65 {
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDIRECT:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDIRECT_INDEX:
-					value = read_byte(bus, effective_address(bus, operand, instruction.mode, result));
+					value = read_byte(bus, effective_address<MODE>(bus, operand, result));
 					break;
 				case INSTRUCTION_MODE_IMMEDIATE:
 					value = operand;
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
 			m_accumulator.low = value;
-			m_status.zero = !value;
-			m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			m_result = value;
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_load_index_x(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -964,31 +1255,30 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_Y:
 				case INSTRUCTION_MODE_ZERO_PAGE:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_Y:
-					value = read_byte(bus, effective_address(bus, operand, instruction.mode, result));
+					value = read_byte(bus, effective_address<MODE>(bus, operand, result));
 					break;
 				case INSTRUCTION_MODE_IMMEDIATE:
 					value = operand;
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
 			m_index_x.low = value;
-			m_status.zero = !value;
-			m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			m_result = value;
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_load_index_y(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -1000,25 +1290,24 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
-					value = read_byte(bus, effective_address(bus, operand, instruction.mode, result));
+					value = read_byte(bus, effective_address<MODE>(bus, operand, result));
 					break;
 				case INSTRUCTION_MODE_IMMEDIATE:
 					value = operand;
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
 			m_index_y.low = value;
-			m_status.zero = !value;
-			m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			m_result = value;
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
@@ -1037,19 +1326,53 @@ namespace c65 {
 			return result;
 		}
 
-		uint8_t
+		template <uint8_t OPCODE> uint8_t
 		processor::execute_no_operation(
-			__in const instruction_t &instruction
+			__in c65::interface::bus &bus,
+			__in const instruction_t &instruction,
+			__in c65_word_t operand
 			)
 		{
 			uint8_t result = 0;
+			constexpr int MODE = instruction_traits<OPCODE>::mode;
+
+			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
+
+			if(MODE != INSTRUCTION_MODE_IMPLIED) {
+				c65_address_t address;
+
+				address.word = (m_program_counter.word - (INSTRUCTION_MODE_LENGTH(MODE) + 1));
+				bus.notify(C65_EVENT_ILLEGAL_INSTRUCTION, address, OPCODE);
+			}
 
-			TRACE_ENTRY_FORMAT("Instruction=%p", &instruction);
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <uint8_t OPCODE, int TIMING> uint8_t
+		processor::execute_opcode(
+			__in c65::interface::bus &bus,
+			__in const instruction_t &instruction,
+			__in c65_word_t operand
+			)
+		{
+			uint8_t result;
+			constexpr handler_t entry = handler<OPCODE>();
+
+			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
+
+			if constexpr(TIMING == C65_TIMING_EXACT) {
+				result = execute_exact<OPCODE>(bus, instruction);
+			} else {
+				m_program_counter.word += (instruction_traits<OPCODE>::length + 1);
+				result = (instruction_traits<OPCODE>::cycle + (this->*entry)(bus, instruction, operand));
+			}
+
+			TRACE_EXIT_FORMAT("Result=%u", result);
+			return result;
+		}
+
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_or(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -1061,7 +1384,7 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_Y:
@@ -1070,30 +1393,30 @@ namespace c65 {
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDIRECT:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDIRECT_INDEX:
-					value = read_byte(bus, effective_address(bus, operand, instruction.mode, result));
+					value = read_byte(bus, effective_address<MODE>(bus, operand, result));
 					break;
 				case INSTRUCTION_MODE_IMMEDIATE:
 					value = operand;
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
 			value = (m_accumulator.low | value);
 			m_accumulator.low = value;
-			m_status.zero = !value;
-			m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			m_result = value;
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_pull(
 			__in c65::interface::bus &bus,
-			__in const instruction_t &instruction
+			__in const instruction_t &instruction,
+			__in c65_word_t operand
 			)
 		{
 			uint8_t result = 0;
@@ -1103,12 +1426,13 @@ namespace c65 {
 
 			value = pull_byte(bus);
 
-			switch(instruction.type) {
+			switch(TYPE) {
 				case INSTRUCTION_PLA:
 					m_accumulator.low = value;
 					break;
 				case INSTRUCTION_PLP:
 					m_status.raw = (value | MASK(FLAG_BREAK_INSTRUCTION));
+					m_result = RESULT(m_status.zero, m_status.negative);
 					break;
 				case INSTRUCTION_PLX:
 					m_index_x.low = value;
@@ -1118,22 +1442,22 @@ namespace c65 {
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_INVALID,
-						"%u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type));
+						"%u(%s)", TYPE, INSTRUCTION_STRING(TYPE));
 			}
 
-			if(instruction.type != INSTRUCTION_PLP) {
-				m_status.zero = !value;
-				m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			if(TYPE != INSTRUCTION_PLP) {
+				m_result = value;
 			}
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_push(
 			__in c65::interface::bus &bus,
-			__in const instruction_t &instruction
+			__in const instruction_t &instruction,
+			__in c65_word_t operand
 			)
 		{
 			uint8_t result = 0;
@@ -1141,12 +1465,12 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p", &bus, &instruction);
 
-			switch(instruction.type) {
+			switch(TYPE) {
 				case INSTRUCTION_PHA:
 					value = m_accumulator.low;
 					break;
 				case INSTRUCTION_PHP:
-					value = m_status.raw;
+					value = status().raw;
 					break;
 				case INSTRUCTION_PHX:
 					value = m_index_x.low;
@@ -1156,7 +1480,7 @@ namespace c65 {
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_INVALID,
-						"%u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type));
+						"%u(%s)", TYPE, INSTRUCTION_STRING(TYPE));
 			}
 
 			push_byte(bus, value);
@@ -1165,7 +1489,7 @@ namespace c65 {
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_reset_bit(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -1177,27 +1501,28 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			address = effective_address(bus, operand, instruction.mode, result);
+			address = effective_address<MODE>(bus, operand, result);
 			operand = read_byte(bus, address);
 
-			switch(instruction.type) {
+			switch(TYPE) {
 				case INSTRUCTION_RMB0 ... INSTRUCTION_RMB7:
-					MASK_CLEAR(operand, instruction.type - INSTRUCTION_RMB0);
+					MASK_CLEAR(operand, TYPE - INSTRUCTION_RMB0);
 					write_byte(bus, address, operand);
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_INVALID,
-						"%u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type));
+						"%u(%s)", TYPE, INSTRUCTION_STRING(TYPE));
 			}
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_return_interrupt(
 			__in c65::interface::bus &bus,
-			__in const instruction_t &instruction
+			__in const instruction_t &instruction,
+			__in c65_word_t operand
 			)
 		{
 			uint8_t result = 0;
@@ -1205,6 +1530,7 @@ namespace c65 {
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p", &bus, &instruction);
 
 			m_status.raw = (pull_byte(bus) | MASK(FLAG_BREAK_INSTRUCTION));
+			m_result = RESULT(m_status.zero, m_status.negative);
 			m_program_counter.word = pull_word(bus);
 			bus.notify(C65_EVENT_INTERRUPT_EXIT, m_program_counter);
 
@@ -1212,10 +1538,11 @@ namespace c65 {
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_return_subroutine(
 			__in c65::interface::bus &bus,
-			__in const instruction_t &instruction
+			__in const instruction_t &instruction,
+			__in c65_word_t operand
 			)
 		{
 			uint8_t result = 0;
@@ -1229,7 +1556,7 @@ namespace c65 {
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_rotate_left(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -1244,12 +1571,12 @@ namespace c65 {
 
 			carry = m_status.carry;
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
-					address = effective_address(bus, operand, instruction.mode, result);
+					address = effective_address<MODE>(bus, operand, result);
 					value = read_byte(bus, address);
 					m_status.carry = MASK_CHECK(value, FLAG_NEGATIVE);
 					value <<= 1;
@@ -1265,18 +1592,17 @@ namespace c65 {
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
-			m_status.zero = !value;
-			m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			m_result = value;
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_rotate_right(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -1291,12 +1617,12 @@ namespace c65 {
 
 			carry = m_status.carry;
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
-					address = effective_address(bus, operand, instruction.mode, result);
+					address = effective_address<MODE>(bus, operand, result);
 					value = read_byte(bus, address);
 					m_status.carry = MASK_CHECK(value, FLAG_CARRY);
 					value >>= 1;
@@ -1312,27 +1638,28 @@ namespace c65 {
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
-			m_status.zero = !value;
-			m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			m_result = value;
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_set(
-			__in const instruction_t &instruction
+			__in c65::interface::bus &bus,
+			__in const instruction_t &instruction,
+			__in c65_word_t operand
 			)
 		{
 			uint8_t result = 0;
 
 			TRACE_ENTRY_FORMAT("Instruction=%p", &instruction);
 
-			switch(instruction.type) {
+			switch(TYPE) {
 				case INSTRUCTION_SEC:
 					m_status.carry = true;
 					break;
@@ -1344,14 +1671,14 @@ namespace c65 {
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_INVALID,
-						"%u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type));
+						"%u(%s)", TYPE, INSTRUCTION_STRING(TYPE));
 			}
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_set_bit(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -1363,24 +1690,24 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			address = effective_address(bus, operand, instruction.mode, result);
+			address = effective_address<MODE>(bus, operand, result);
 			operand = read_byte(bus, address);
 
-			switch(instruction.type) {
+			switch(TYPE) {
 				case INSTRUCTION_SMB0 ... INSTRUCTION_SMB7:
-					MASK_SET(operand, instruction.type - INSTRUCTION_SMB0);
+					MASK_SET(operand, TYPE - INSTRUCTION_SMB0);
 					write_byte(bus, address, operand);
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_INVALID,
-						"%u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type));
+						"%u(%s)", TYPE, INSTRUCTION_STRING(TYPE));
 			}
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_shift_left(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -1393,12 +1720,12 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
-					address = effective_address(bus, operand, instruction.mode, result);
+					address = effective_address<MODE>(bus, operand, result);
 					value = read_byte(bus, address);
 					m_status.carry = MASK_CHECK(value, FLAG_NEGATIVE);
 					value <<= 1;
@@ -1412,18 +1739,17 @@ namespace c65 {
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
-			m_status.zero = !value;
-			m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			m_result = value;
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_shift_right(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -1436,12 +1762,12 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
-					address = effective_address(bus, operand, instruction.mode, result);
+					address = effective_address<MODE>(bus, operand, result);
 					value = read_byte(bus, address);
 					m_status.carry = MASK_CHECK(value, FLAG_CARRY);
 					value >>= 1;
@@ -1455,21 +1781,21 @@ namespace c65 {
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
-			m_status.zero = !value;
-			m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			m_result = value;
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_stop(
-			__in const c65::interface::bus &bus,
-			__in const instruction_t &instruction
+			__in c65::interface::bus &bus,
+			__in const instruction_t &instruction,
+			__in c65_word_t operand
 			)
 		{
 			uint8_t result = 0;
@@ -1483,7 +1809,7 @@ namespace c65 {
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_store_accumulator(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -1494,7 +1820,7 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_Y:
@@ -1503,23 +1829,23 @@ namespace c65 {
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDIRECT:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDIRECT_INDEX:
-					write_byte(bus, effective_address(bus, operand, instruction.mode, result), m_accumulator.low);
+					write_byte(bus, effective_address<MODE>(bus, operand, result), m_accumulator.low);
 
-					if((instruction.mode == INSTRUCTION_MODE_ABSOLUTE_INDEX_X) && !result) {
+					if((MODE == INSTRUCTION_MODE_ABSOLUTE_INDEX_X) && !result) {
 						result += CYCLE_PAGE_CROSSED;
 					}
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
 			TRACE_EXIT_FORMAT("Result=%u(%02x)", result, result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_store_index_x(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -1530,23 +1856,23 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ZERO_PAGE:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_Y:
-					write_byte(bus, effective_address(bus, operand, instruction.mode, result), m_index_x.low);
+					write_byte(bus, effective_address<MODE>(bus, operand, result), m_index_x.low);
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
 			TRACE_EXIT_FORMAT("Result=%u(%02x)", result, result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_store_index_y(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -1557,23 +1883,23 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ZERO_PAGE:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
-					write_byte(bus, effective_address(bus, operand, instruction.mode, result), m_index_y.low);
+					write_byte(bus, effective_address<MODE>(bus, operand, result), m_index_y.low);
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
 			TRACE_EXIT_FORMAT("Result=%u(%02x)", result, result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_store_zero(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -1584,24 +1910,24 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
-					write_byte(bus, effective_address(bus, operand, instruction.mode, result), 0);
+					write_byte(bus, effective_address<MODE>(bus, operand, result), 0);
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
 			TRACE_EXIT_FORMAT("Result=%u(%02x)", result, result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_subtract(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -1613,7 +1939,7 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_Y:
@@ -1622,24 +1948,29 @@ namespace c65 {
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDIRECT:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDIRECT_INDEX:
-					value = read_byte(bus, effective_address(bus, operand, instruction.mode, result));
+					value = read_byte(bus, effective_address<MODE>(bus, operand, result));
 					break;
 				case INSTRUCTION_MODE_IMMEDIATE:
 					value = operand;
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
-			add_carry(~value);
+			if(m_status.decimal_mode) {
+				add_decimal(value, true);
+				result += CYCLE_DECIMAL;
+			} else {
+				add_carry(~value);
+			}
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_test_reset_bit(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -1652,9 +1983,9 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			address = effective_address(bus, operand, instruction.mode, result);
+			address = effective_address<MODE>(bus, operand, result);
 			value = read_byte(bus, address);
-			m_status.zero = BIT_CHECK(value, m_accumulator.low);
+			m_result = RESULT(BIT_CHECK(value, m_accumulator.low), RESULT_NEGATIVE_CHECK(m_result));
 			BIT_CLEAR(value, m_accumulator.low);
 			write_byte(bus, address, value);
 
@@ -1662,7 +1993,7 @@ namespace c65 {
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_test_set_bit(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -1675,9 +2006,9 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			address = effective_address(bus, operand, instruction.mode, result);
+			address = effective_address<MODE>(bus, operand, result);
 			value = read_byte(bus, address);
-			m_status.zero = BIT_CHECK(value, m_accumulator.low);
+			m_result = RESULT(BIT_CHECK(value, m_accumulator.low), RESULT_NEGATIVE_CHECK(m_result));
 			BIT_SET(value, m_accumulator.low);
 			write_byte(bus, address, value);
 
@@ -1685,9 +2016,11 @@ namespace c65 {
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_transfer(
-			__in const instruction_t &instruction
+			__in c65::interface::bus &bus,
+			__in const instruction_t &instruction,
+			__in c65_word_t operand
 			)
 		{
 			uint8_t result = 0;
@@ -1695,7 +2028,7 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Instruction=%p", &instruction);
 
-			switch(instruction.type) {
+			switch(TYPE) {
 				case INSTRUCTION_TAX:
 					value = m_accumulator.low;
 					m_index_x.low = value;
@@ -1722,22 +2055,22 @@ namespace c65 {
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_INVALID,
-						"%u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type));
+						"%u(%s)", TYPE, INSTRUCTION_STRING(TYPE));
 			}
 
-			if(instruction.type != INSTRUCTION_TXS) {
-				m_status.zero = !value;
-				m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			if(TYPE != INSTRUCTION_TXS) {
+				m_result = value;
 			}
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_wait(
-			__in const c65::interface::bus &bus,
-			__in const instruction_t &instruction
+			__in c65::interface::bus &bus,
+			__in const instruction_t &instruction,
+			__in c65_word_t operand
 			)
 		{
 			uint8_t result = 0;
@@ -1751,7 +2084,7 @@ namespace c65 {
 			return result;
 		}
 
-		uint8_t
+		template <int TYPE, int MODE> uint8_t
 		processor::execute_xor(
 			__in c65::interface::bus &bus,
 			__in const instruction_t &instruction,
@@ -1763,7 +2096,7 @@ namespace c65 {
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Instruction=%p, Operand=%u(%04x)", &bus, &instruction, operand, operand);
 
-			switch(instruction.mode) {
+			switch(MODE) {
 				case INSTRUCTION_MODE_ABSOLUTE:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_X:
 				case INSTRUCTION_MODE_ABSOLUTE_INDEX_Y:
@@ -1772,26 +2105,189 @@ namespace c65 {
 				case INSTRUCTION_MODE_ZERO_PAGE_INDEX_X:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDIRECT:
 				case INSTRUCTION_MODE_ZERO_PAGE_INDIRECT_INDEX:
-					value = read_byte(bus, effective_address(bus, operand, instruction.mode, result));
+					value = read_byte(bus, effective_address<MODE>(bus, operand, result));
 					break;
 				case INSTRUCTION_MODE_IMMEDIATE:
 					value = operand;
 					break;
 				default:
 					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
-						"%u(%s), %u(%s)", instruction.type, INSTRUCTION_STRING(instruction.type),
-						instruction.mode, INSTRUCTION_MODE_STRING(instruction.mode));
+						"%u(%s), %u(%s)", TYPE, INSTRUCTION_STRING(TYPE),
+						MODE, INSTRUCTION_MODE_STRING(MODE));
 			}
 
 			value = (m_accumulator.low ^ value);
 			m_accumulator.low = value;
-			m_status.zero = !value;
-			m_status.negative = MASK_CHECK(value, FLAG_NEGATIVE);
+			m_result = value;
 
 			TRACE_EXIT_FORMAT("Result=%u", result);
 			return result;
 		}
 
+		uint32_t
+		processor::elapsed(void) const
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT_FORMAT("Result=%u", m_elapsed);
+			return m_elapsed;
+		}
+
+		void
+		processor::flush(void)
+		{
+			TRACE_ENTRY();
+
+			if(++m_generation == DECODE_GENERATION_INVALID) {
+				std::fill(m_decode.begin(), m_decode.end(), decode_t());
+				std::fill(m_block_cover.begin(), m_block_cover.end(), DECODE_GENERATION_INVALID);
+
+				for(block_t &block : m_block) {
+					block.generation = DECODE_GENERATION_INVALID;
+				}
+
+				m_generation = DECODE_GENERATION_RESET;
+			}
+
+			TRACE_EXIT();
+		}
+
+		template <uint8_t OPCODE> constexpr processor::handler_t
+		processor::handler(void)
+		{
+			handler_t result = nullptr;
+			constexpr int TYPE = instruction_traits<OPCODE>::type, MODE = instruction_traits<OPCODE>::mode;
+
+			if constexpr(TYPE == INSTRUCTION_ADC) {
+				result = &processor::execute_add<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_AND) {
+				result = &processor::execute_and<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_BIT) {
+				result = &processor::execute_bit<TYPE, MODE>;
+			} else if constexpr((TYPE == INSTRUCTION_BCC) || (TYPE == INSTRUCTION_BCS) || (TYPE == INSTRUCTION_BEQ) || (TYPE == INSTRUCTION_BMI) || (TYPE == INSTRUCTION_BNE) || (TYPE == INSTRUCTION_BPL) || (TYPE == INSTRUCTION_BRA) || (TYPE == INSTRUCTION_BVC) || (TYPE == INSTRUCTION_BVS)) {
+				result = &processor::execute_branch<TYPE, MODE>;
+			} else if constexpr((TYPE >= INSTRUCTION_BBR0) && (TYPE <= INSTRUCTION_BBS7)) {
+				result = &processor::execute_branch_bit<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_BRK) {
+				result = &processor::execute_break<TYPE, MODE>;
+			} else if constexpr((TYPE == INSTRUCTION_CLC) || (TYPE == INSTRUCTION_CLD) || (TYPE == INSTRUCTION_CLI) || (TYPE == INSTRUCTION_CLV)) {
+				result = &processor::execute_clear<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_CMP) {
+				result = &processor::execute_compare<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_CPX) {
+				result = &processor::execute_compare_index_x<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_CPY) {
+				result = &processor::execute_compare_index_y<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_DEC) {
+				result = &processor::execute_decrement<TYPE, MODE>;
+			} else if constexpr((TYPE == INSTRUCTION_DEX) || (TYPE == INSTRUCTION_DEY)) {
+				result = &processor::execute_decrement_index<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_INC) {
+				result = &processor::execute_increment<TYPE, MODE>;
+			} else if constexpr((TYPE == INSTRUCTION_INX) || (TYPE == INSTRUCTION_INY)) {
+				result = &processor::execute_increment_index<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_JMP) {
+				result = &processor::execute_jump<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_JSR) {
+				result = &processor::execute_jump_subroutine<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_LDA) {
+				result = &processor::execute_load_accumulator<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_LDX) {
+				result = &processor::execute_load_index_x<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_LDY) {
+				result = &processor::execute_load_index_y<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_ORA) {
+				result = &processor::execute_or<TYPE, MODE>;
+			} else if constexpr((TYPE == INSTRUCTION_PLA) || (TYPE == INSTRUCTION_PLP) || (TYPE == INSTRUCTION_PLX) || (TYPE == INSTRUCTION_PLY)) {
+				result = &processor::execute_pull<TYPE, MODE>;
+			} else if constexpr((TYPE == INSTRUCTION_PHA) || (TYPE == INSTRUCTION_PHP) || (TYPE == INSTRUCTION_PHX) || (TYPE == INSTRUCTION_PHY)) {
+				result = &processor::execute_push<TYPE, MODE>;
+			} else if constexpr((TYPE >= INSTRUCTION_RMB0) && (TYPE <= INSTRUCTION_RMB7)) {
+				result = &processor::execute_reset_bit<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_RTI) {
+				result = &processor::execute_return_interrupt<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_RTS) {
+				result = &processor::execute_return_subroutine<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_ROL) {
+				result = &processor::execute_rotate_left<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_ROR) {
+				result = &processor::execute_rotate_right<TYPE, MODE>;
+			} else if constexpr((TYPE == INSTRUCTION_SEC) || (TYPE == INSTRUCTION_SED) || (TYPE == INSTRUCTION_SEI)) {
+				result = &processor::execute_set<TYPE, MODE>;
+			} else if constexpr((TYPE >= INSTRUCTION_SMB0) && (TYPE <= INSTRUCTION_SMB7)) {
+				result = &processor::execute_set_bit<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_ASL) {
+				result = &processor::execute_shift_left<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_LSR) {
+				result = &processor::execute_shift_right<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_STP) {
+				result = &processor::execute_stop<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_STA) {
+				result = &processor::execute_store_accumulator<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_STX) {
+				result = &processor::execute_store_index_x<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_STY) {
+				result = &processor::execute_store_index_y<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_STZ) {
+				result = &processor::execute_store_zero<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_SBC) {
+				result = &processor::execute_subtract<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_TRB) {
+				result = &processor::execute_test_reset_bit<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_TSB) {
+				result = &processor::execute_test_set_bit<TYPE, MODE>;
+			} else if constexpr((TYPE == INSTRUCTION_TAX) || (TYPE == INSTRUCTION_TAY) || (TYPE == INSTRUCTION_TSX) || (TYPE == INSTRUCTION_TXA) || (TYPE == INSTRUCTION_TXS) || (TYPE == INSTRUCTION_TYA)) {
+				result = &processor::execute_transfer<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_WAI) {
+				result = &processor::execute_wait<TYPE, MODE>;
+			} else if constexpr(TYPE == INSTRUCTION_EOR) {
+				result = &processor::execute_xor<TYPE, MODE>;
+			} else {
+				result = &processor::execute_no_operation<OPCODE>;
+			}
+
+			return result;
+		}
+
+		template <int TIMING, std::size_t... OPCODE> constexpr std::array<processor::handler_t, sizeof...(OPCODE)>
+		processor::handler_table(
+			__in std::index_sequence<OPCODE...> opcode
+			)
+		{
+			return {{ &processor::execute_opcode<OPCODE, TIMING>... }};
+		}
+
+		bool
+		processor::idle(
+			__inout idle_t &state
+			)
+		{
+			bool result;
+			idle_t current = {};
+
+			TRACE_ENTRY_FORMAT("State=%p", &state);
+
+			current.program_counter = m_program_counter.word;
+			current.accumulator = m_accumulator.low;
+			current.index_x = m_index_x.low;
+			current.index_y = m_index_y.low;
+			current.stack_pointer = m_stack_pointer.low;
+			current.status = status().raw;
+			current.interrupt = m_interrupt;
+			current.write = m_write;
+			result = ((current.program_counter == state.program_counter)
+					&& (current.accumulator == state.accumulator)
+					&& (current.index_x == state.index_x)
+					&& (current.index_y == state.index_y)
+					&& (current.stack_pointer == state.stack_pointer)
+					&& (current.status == state.status)
+					&& (current.interrupt == state.interrupt)
+					&& (current.write == state.write));
+			state = current;
+
+			TRACE_EXIT_FORMAT("Result=%x", result);
+			return result;
+		}
+
 		void
 		processor::interrupt(
 			__in int type
@@ -1827,6 +2323,28 @@ namespace c65 {
 			return result;
 		}
 
+		void
+		processor::invalidate(
+			__in c65_address_t address
+			)
+		{
+			int offset = 0;
+
+			TRACE_ENTRY_FORMAT("Address=%u(%04x)", address.word, address.word);
+
+			++m_write;
+
+			if(m_block_cover[address.word] == m_generation) {
+				flush();
+			}
+
+			for(; offset <= INSTRUCTION_LENGTH_WORD; ++offset, --address.word) {
+				m_decode[address.word].generation = DECODE_GENERATION_INVALID;
+			}
+
+			TRACE_EXIT();
+		}
+
 		void
 		processor::on_initialize(void)
 		{
@@ -1837,6 +2355,9 @@ namespace c65 {
 			m_maskable.word = DEFAULT_INTERRUPT_MASKABLE;
 			m_non_maskable.word = DEFAULT_INTERRUPT_NON_MASKABLE;
 			m_reset.word = DEFAULT_INTERRUPT_RESET;
+			m_engine = C65_ENGINE_INTERPRETER;
+			m_timing = C65_TIMING_FAST;
+			flush();
 
 			TRACE_MESSAGE(LEVEL_INFORMATION, "Processor initialized");
 
@@ -1906,9 +2427,11 @@ namespace c65 {
 			m_reset = {};
 			m_stack = STACK_NONE;
 			m_stack_pointer = {};
+			m_result = RESULT(false, false);
 			m_status = {};
 			m_stop = false;
 			m_wait = false;
+			flush();
 
 			TRACE_MESSAGE(LEVEL_INFORMATION, "Processor uninitialized");
 
@@ -2058,6 +2581,14 @@ namespace c65 {
 			return result;
 		}
 
+		int
+		processor::read_engine(void) const
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT_FORMAT("Result=%i(%s)", m_engine, ENGINE_STRING(m_engine));
+			return m_engine;
+		}
+
 		c65_register_t
 		processor::read_register(
 			__in int type
@@ -2094,10 +2625,23 @@ namespace c65 {
 
 		c65_status_t
 		processor::read_status(void) const
+		{
+			c65_status_t result;
+
+			TRACE_ENTRY();
+
+			result = status();
+
+			TRACE_EXIT_FORMAT("Result=%u(%02x)", result.raw, result.raw);
+			return result;
+		}
+
+		int
+		processor::read_timing(void) const
 		{
 			TRACE_ENTRY();
-			TRACE_EXIT_FORMAT("Result=%u(%02x)", m_status.raw);
-			return m_status;
+			TRACE_EXIT_FORMAT("Result=%i(%s)", m_timing, TIMING_STRING(m_timing));
+			return m_timing;
 		}
 
 		c65_word_t
@@ -2135,6 +2679,8 @@ namespace c65 {
 			m_stack = STACK_NONE;
 			m_stack_pointer.word = RESET_STACK_POINTER;
 			m_status.raw = RESET_STATUS;
+			m_result = RESULT(m_status.zero, m_status.negative);
+			flush();
 
 			if(m_stop) {
 				m_stop = false;
@@ -2151,6 +2697,58 @@ namespace c65 {
 			TRACE_EXIT();
 		}
 
+		uint32_t
+		processor::run(
+			__in c65::interface::bus &bus,
+			__in uint32_t cycle,
+			__in const address_set_t *breakpoint
+			)
+		{
+			idle_t state = {};
+			uint32_t result = 0;
+
+			TRACE_ENTRY_FORMAT("Bus=%p, Cycle=%u, Breakpoint=%p", &bus, cycle, breakpoint);
+
+			// events raised during the run see the cycles spent so far, at instruction granularity
+			m_elapsed = 0;
+
+			if(m_stop || (m_wait && !MASK_CHECK(m_interrupt, C65_INTERRUPT_NON_MASKABLE)
+					&& (m_status.interrupt_disable || !MASK_CHECK(m_interrupt, C65_INTERRUPT_MASKABLE)))) {
+				TRACE_MESSAGE_FORMAT(LEVEL_VERBOSE, "Processor suspended", "[%04x] %u cycles", m_program_counter.word, cycle);
+				result = cycle;
+			} else {
+				state.write = (m_write - 1);
+
+				for(;;) {
+					c65_word_t previous = m_program_counter.word;
+
+					result += (breakpoint ? step(bus) : step_block(bus));
+					m_elapsed = result;
+
+					if((result >= cycle) || m_stop || m_wait) {
+						break;
+					}
+
+					if((m_program_counter.word <= previous) && idle(state)) {
+						TRACE_MESSAGE_FORMAT(LEVEL_VERBOSE, "Processor idle", "[%04x] %u cycles", m_program_counter.word,
+							cycle - result);
+						result = cycle;
+						break;
+					}
+
+					if(breakpoint && breakpoint->test(m_program_counter.word)) {
+						break;
+					}
+				}
+			}
+
+			// the caller folds the result into its own count
+			m_elapsed = 0;
+
+			TRACE_EXIT_FORMAT("Result=%u", result);
+			return result;
+		}
+
 		uint8_t
 		processor::service(
 			__in c65::interface::bus &bus
@@ -2188,7 +2786,21 @@ namespace c65 {
 
 					if(taken) {
 						MASK_CLEAR(m_interrupt, type);
-						result += service_interrupt(bus, address, false);
+
+						if(m_timing == C65_TIMING_EXACT) {
+							cycle_bus cycle(bus);
+							c65_address_t vector = {};
+
+							// the discarded opcode fetch and an internal cycle precede the stack and vector cycles
+							cycle.idle(m_program_counter, 2);
+							service_interrupt(cycle, address, false);
+							vector.word = ((type == C65_INTERRUPT_MASKABLE) ? ADDRESS_PROCESSOR_MASKABLE_BEGIN
+								: ADDRESS_PROCESSOR_NON_MASKABLE_BEGIN);
+							read_word(cycle, vector);
+							result += cycle.access();
+						} else {
+							result += service_interrupt(bus, address, false);
+						}
 					}
 
 					break;
@@ -2206,7 +2818,7 @@ namespace c65 {
 			__in bool breakpoint
 			)
 		{
-			c65_status_t status = m_status;
+			c65_status_t status = this->status();
 			uint8_t result = CYCLE_INTERRUPT;
 
 			TRACE_ENTRY_FORMAT("Bus=%p, Address=%u(%04x), Breakpoint=%x", &bus, address.word, address.word, breakpoint);
@@ -2279,6 +2891,27 @@ namespace c65 {
 			return result;
 		}
 
+		uint32_t
+		processor::step_block(
+			__in c65::interface::bus &bus
+			)
+		{
+			uint32_t result = 0;
+
+			TRACE_ENTRY_FORMAT("Bus=%p", &bus);
+
+			if((m_engine == C65_ENGINE_BLOCK) && (m_timing != C65_TIMING_EXACT) && !m_stop && !m_wait) {
+				result += service(bus);
+				m_elapsed += result;
+				result += execute_block(bus);
+			} else {
+				result += step(bus);
+			}
+
+			TRACE_EXIT_FORMAT("Result=%u", result);
+			return result;
+		}
+
 		bool
 		processor::stopped(void) const
 		{
@@ -2287,6 +2920,98 @@ namespace c65 {
 			return m_stop;
 		}
 
+		c65_status_t
+		processor::status(void) const
+		{
+			c65_status_t result = m_status;
+
+			TRACE_ENTRY();
+
+			result.zero = RESULT_ZERO_CHECK(m_result);
+			result.negative = RESULT_NEGATIVE_CHECK(m_result);
+
+			TRACE_EXIT_FORMAT("Result=%u(%02x)", result.raw, result.raw);
+			return result;
+		}
+
+		const processor::block_t &
+		processor::translate(
+			__in c65::interface::bus &bus
+			)
+		{
+			TRACE_ENTRY_FORMAT("Bus=%p", &bus);
+
+			block_t &result = m_block[m_program_counter.word];
+			if(result.generation != m_generation) {
+				bool end = false;
+				c65_address_t address = m_program_counter;
+
+				result.entry.clear();
+
+				while(!end && (result.entry.size() < BLOCK_LENGTH_MAX)) {
+					uint32_t begin = address.word;
+					c65_address_t last;
+
+					// code read through on_read may have side effects, so it is left to execute, which fetches it once
+					last.word = (address.word + INSTRUCTION_LENGTH_WORD);
+					if(!bus.cacheable(address) || !bus.cacheable(last)) {
+						break;
+					}
+
+					const decode_t &entry = decode(bus, address);
+					if(entry.generation == DECODE_GENERATION_INVALID) {
+						break;
+					}
+
+					const instruction_t &instruction = INSTRUCTION(entry.opcode);
+					if((begin + instruction.length) >= UINT16_MAX) {
+						break;
+					}
+
+					result.entry.push_back(entry);
+
+					for(; address.word <= (begin + instruction.length); ++address.word) {
+						m_block_cover[address.word] = m_generation;
+					}
+
+					switch(instruction.type) {
+						case INSTRUCTION_BBR0 ... INSTRUCTION_BBS7:
+						case INSTRUCTION_BCC:
+						case INSTRUCTION_BCS:
+						case INSTRUCTION_BEQ:
+						case INSTRUCTION_BMI:
+						case INSTRUCTION_BNE:
+						case INSTRUCTION_BPL:
+						case INSTRUCTION_BRA:
+						case INSTRUCTION_BRK:
+						case INSTRUCTION_BVC:
+						case INSTRUCTION_BVS:
+						case INSTRUCTION_CLI:
+						case INSTRUCTION_JMP:
+						case INSTRUCTION_JSR:
+						case INSTRUCTION_PLP:
+						case INSTRUCTION_RTI:
+						case INSTRUCTION_RTS:
+						case INSTRUCTION_SEI:
+						case INSTRUCTION_STP:
+						case INSTRUCTION_WAI:
+							end = true;
+							break;
+						default:
+							break;
+					}
+				}
+
+				result.generation = m_generation;
+
+				TRACE_MESSAGE_FORMAT(LEVEL_VERBOSE, "Block", "[%04x] %u", m_program_counter.word,
+					(uint32_t)result.entry.size());
+			}
+
+			TRACE_EXIT_FORMAT("Result=%p", &result);
+			return result;
+		}
+
 		bool
 		processor::waiting(void) const
 		{
@@ -2309,6 +3034,26 @@ namespace c65 {
 			TRACE_EXIT();
 		}
 
+		void
+		processor::write_engine(
+			__in int type
+			)
+		{
+			TRACE_ENTRY_FORMAT("Type=%i(%s)", type, ENGINE_STRING(type));
+
+			switch(type) {
+				case C65_ENGINE_BLOCK:
+				case C65_ENGINE_INTERPRETER:
+					m_engine = type;
+					break;
+				default:
+					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_ENGINE_INVALID,
+						"%i(%s)", type, ENGINE_STRING(type));
+			}
+
+			TRACE_EXIT();
+		}
+
 		void
 		processor::write_register(
 			__in int type,
@@ -2350,6 +3095,28 @@ namespace c65 {
 			TRACE_ENTRY_FORMAT("Value=%u(%02x)", value.raw, value.raw);
 
 			m_status = value;
+			m_result = RESULT(m_status.zero, m_status.negative);
+
+			TRACE_EXIT();
+		}
+
+		void
+		processor::write_timing(
+			__in int type
+			)
+		{
+			TRACE_ENTRY_FORMAT("Type=%i(%s)", type, TIMING_STRING(type));
+
+			switch(type) {
+				case C65_TIMING_EXACT:
+				case C65_TIMING_FAST:
+					m_timing = type;
+					flush();
+					break;
+				default:
+					THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(C65_SYSTEM_PROCESSOR_EXCEPTION_TIMING_INVALID,
+						"%i(%s)", type, TIMING_STRING(type));
+			}
 
 			TRACE_EXIT();
 		}
@@ -2369,5 +3136,12 @@ namespace c65 {
 
 			TRACE_EXIT();
 		}
+
+		const std::vector<c65_word_t> processor::DECIMAL = processor::decimal_table();
+
+		const std::array<std::array<processor::handler_t, UINT8_MAX + 1>, C65_TIMING_MAX + 1> processor::HANDLER = {{
+			processor::handler_table<C65_TIMING_FAST>(std::make_index_sequence<UINT8_MAX + 1>()),
+			processor::handler_table<C65_TIMING_EXACT>(std::make_index_sequence<UINT8_MAX + 1>()),
+			}};
 	}
 }
@@ -34,20 +34,24 @@ namespace c65 {
 
 		enum {
 			C65_SYSTEM_PROCESSOR_EXCEPTION_ADDRESS_INVALID = 0,
+			C65_SYSTEM_PROCESSOR_EXCEPTION_ENGINE_INVALID,
 			C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_INVALID,
 			C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID,
 			C65_SYSTEM_PROCESSOR_EXCEPTION_INTERRUPT_INVALID,
 			C65_SYSTEM_PROCESSOR_EXCEPTION_REGISTER_INVALID,
+			C65_SYSTEM_PROCESSOR_EXCEPTION_TIMING_INVALID,
 		};
 
-		#define C65_SYSTEM_PROCESSOR_EXCEPTION_MAX C65_SYSTEM_PROCESSOR_EXCEPTION_REGISTER_INVALID
+		#define C65_SYSTEM_PROCESSOR_EXCEPTION_MAX C65_SYSTEM_PROCESSOR_EXCEPTION_TIMING_INVALID
 
 		static const std::string C65_SYSTEM_PROCESSOR_EXCEPTION_STR[] = {
 			C65_SYSTEM_PROCESSOR_EXCEPTION_HEADER "Invalid address", // C65_SYSTEM_PROCESSOR_EXCEPTION_ADDRESS_INVALID
+			C65_SYSTEM_PROCESSOR_EXCEPTION_HEADER "Invalid engine", // C65_SYSTEM_PROCESSOR_EXCEPTION_ENGINE_INVALID
 			C65_SYSTEM_PROCESSOR_EXCEPTION_HEADER "Invalid instruction", // C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_INVALID
 			C65_SYSTEM_PROCESSOR_EXCEPTION_HEADER "Invalid instruction mode", // C65_SYSTEM_PROCESSOR_EXCEPTION_INSTRUCTION_MODE_INVALID
 			C65_SYSTEM_PROCESSOR_EXCEPTION_HEADER "Invalid interrupt", // C65_SYSTEM_PROCESSOR_EXCEPTION_INTERRUPT_INVALID
 			C65_SYSTEM_PROCESSOR_EXCEPTION_HEADER "Invalid register", // C65_SYSTEM_PROCESSOR_EXCEPTION_REGISTER_INVALID
+			C65_SYSTEM_PROCESSOR_EXCEPTION_HEADER "Invalid timing", // C65_SYSTEM_PROCESSOR_EXCEPTION_TIMING_INVALID
 			};
 
 		#define C65_SYSTEM_PROCESSOR_EXCEPTION_STRING(_TYPE_) \
@@ -59,15 +63,41 @@ namespace c65 {
 		#define THROW_C65_SYSTEM_PROCESSOR_EXCEPTION_FORMAT(_EXCEPT_, _FORMAT_, ...) \
 			THROW_EXCEPTION(C65_SYSTEM_PROCESSOR_EXCEPTION_STRING(_EXCEPT_), _FORMAT_, __VA_ARGS__)
 
+		#define BLOCK_LENGTH_MAX 32
+
 		#define CYCLE_BRANCH_TAKEN 1
+		#define CYCLE_DECIMAL 1
 		#define CYCLE_INTERRUPT 7
 		#define CYCLE_PAGE_CROSSED 1
 		#define CYCLE_READ_MODIFY_WRITE 2
 
+		#define DECIMAL_CARRY 0x0100
+		#define DECIMAL_OVERFLOW 0x0200
+
+		#define DECIMAL_INDEX(_SUBTRACT_, _CARRY_, _ACCUMULATOR_, _VALUE_) \
+			((((_SUBTRACT_) ? 1 : 0) << 17) | (((_CARRY_) ? 1 : 0) << 16) | ((_ACCUMULATOR_) << CHAR_BIT) | (_VALUE_))
+		#define DECIMAL_LENGTH \
+			(DECIMAL_INDEX(true, true, UINT8_MAX, UINT8_MAX) + 1)
+
+		#define DECODE_GENERATION_INVALID 0
+		#define DECODE_GENERATION_RESET 1
+
 		#define DEFAULT_INTERRUPT_MASKABLE ADDRESS_MEMORY_ZERO_PAGE_BEGIN
 		#define DEFAULT_INTERRUPT_NON_MASKABLE ADDRESS_MEMORY_ZERO_PAGE_BEGIN
 		#define DEFAULT_INTERRUPT_RESET ADDRESS_MEMORY_HIGH_BEGIN
 
+		#define RESULT_NEGATIVE 0x8080
+		#define RESULT_NEGATIVE_SET 0x8000
+		#define RESULT_ZERO 0x00ff
+		#define RESULT_ZERO_CLEAR 0x0001
+
+		#define RESULT(_ZERO_, _NEGATIVE_) \
+			(((_ZERO_) ? 0 : RESULT_ZERO_CLEAR) | ((_NEGATIVE_) ? RESULT_NEGATIVE_SET : 0))
+		#define RESULT_NEGATIVE_CHECK(_RESULT_) \
+			(((_RESULT_) & RESULT_NEGATIVE) ? true : false)
+		#define RESULT_ZERO_CHECK(_RESULT_) \
+			(((_RESULT_) & RESULT_ZERO) ? false : true)
+
 		#define RESET_STACK_POINTER ADDRESS_MEMORY_STACK_END
 		#define RESET_STATUS (MASK(FLAG_BREAK_INSTRUCTION) | MASK(FLAG_INTERRUPT_DISABLE) | MASK(FLAG_UNUSED))
 	}
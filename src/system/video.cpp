@@ -54,6 +54,27 @@ namespace c65 {
 			TRACE_EXIT();
 		}
 
+		const c65_byte_t *
+		video::data(
+			__in c65_address_t address
+			) const
+		{
+			const c65_byte_t *result = nullptr;
+
+			TRACE_ENTRY_FORMAT("Address=%u(%04x)", address.word, address.word);
+
+			switch(address.word) {
+				case ADDRESS_VIDEO_BEGIN ... ADDRESS_VIDEO_END:
+					result = &m_color.at(address.word - ADDRESS_VIDEO_BEGIN);
+					break;
+				default:
+					break;
+			}
+
+			TRACE_EXIT_FORMAT("Result=%p", result);
+			return result;
+		}
+
 		void
 		video::create_display(void)
 		{
@@ -134,6 +155,28 @@ namespace c65 {
 			TRACE_EXIT();
 		}
 
+		void
+		video::fill(
+			__in c65_address_t base,
+			__in c65_dword_t length,
+			__in c65_byte_t value
+			)
+		{
+			TRACE_ENTRY_FORMAT("Base=%u(%04x), Length=%u(%08x), Value=%u(%02x)", base.word, base.word, length, length,
+				value, value);
+
+			if((base.word < ADDRESS_VIDEO_BEGIN) || ((base.word + length) > (ADDRESS_VIDEO_END + 1))) {
+				THORW_C65_SYSTEM_VIDEO_EXCEPTION_FORMAT(C65_SYSTEM_VIDEO_EXCEPTION_ADDRESS_INVALID, "%u(%04x), %u(%08x)",
+					base.word, base.word, length, length);
+			}
+
+			std::fill_n(m_color.begin() + (base.word - ADDRESS_VIDEO_BEGIN), length, value);
+			std::fill_n(m_pixel.begin() + (base.word - ADDRESS_VIDEO_BEGIN), length, COLOR(value));
+			m_changed = true;
+
+			TRACE_EXIT();
+		}
+
 		void
 		video::frame_rate(
 			__in float rate
@@ -149,6 +192,34 @@ namespace c65 {
 			TRACE_EXIT();
 		}
 
+		void
+		video::load(
+			__in const c65_byte_t *data,
+			__in c65_dword_t length,
+			__in c65_address_t base
+			)
+		{
+			size_t index;
+
+			TRACE_ENTRY_FORMAT("Data[%u(%08x)]=%p, Base=%u(%04x)", length, length, data, base.word, base.word);
+
+			if((base.word < ADDRESS_VIDEO_BEGIN) || ((base.word + length) > (ADDRESS_VIDEO_END + 1))) {
+				THORW_C65_SYSTEM_VIDEO_EXCEPTION_FORMAT(C65_SYSTEM_VIDEO_EXCEPTION_ADDRESS_INVALID, "%u(%04x), %u(%08x)",
+					base.word, base.word, length, length);
+			}
+
+			index = (base.word - ADDRESS_VIDEO_BEGIN);
+			std::memcpy(&m_color[index], data, length);
+
+			for(; length; --length, ++index) {
+				m_pixel[index] = COLOR(m_color[index]);
+			}
+
+			m_changed = true;
+
+			TRACE_EXIT();
+		}
+
 		void
 		video::on_initialize(void)
 		{
@@ -189,7 +260,7 @@ namespace c65 {
 
 			switch(address.word) {
 				case ADDRESS_VIDEO_BEGIN ... ADDRESS_VIDEO_END:
-					result = m_color.at(address.word - ADDRESS_VIDEO_BEGIN);
+					result = m_color[address.word - ADDRESS_VIDEO_BEGIN];
 					break;
 				default:
 					THORW_C65_SYSTEM_VIDEO_EXCEPTION_FORMAT(C65_SYSTEM_VIDEO_EXCEPTION_ADDRESS_INVALID, "%u(%04x)",
@@ -233,8 +304,8 @@ namespace c65 {
 			switch(address.word) {
 				case ADDRESS_VIDEO_BEGIN ... ADDRESS_VIDEO_END:
 					index = (address.word - ADDRESS_VIDEO_BEGIN);
-					m_color.at(index) = value;
-					m_pixel.at(index) = COLOR(value);
+					m_color[index] = value;
+					m_pixel[index] = COLOR(value);
 					m_changed = true;
 					break;
 				default:
@@ -0,0 +1,158 @@
+/**
+ * C65
+ * Copyright (C) 2019 David Jolly
+ *
+ * C65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // __linux__
+#include "../../include/type/mapping.h"
+#include "../../include/type/trace.h"
+#include "./mapping_type.h"
+
+namespace c65 {
+
+	namespace type {
+
+		mapping::mapping(void) :
+			m_data(nullptr),
+			m_size(0)
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT();
+		}
+
+		mapping::~mapping(void)
+		{
+			TRACE_ENTRY();
+
+			unmap();
+
+			TRACE_EXIT();
+		}
+
+		const c65_byte_t *
+		mapping::data(void) const
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT_FORMAT("Result=%p", m_data);
+			return m_data;
+		}
+
+		bool
+		mapping::empty(void) const
+		{
+			bool result;
+
+			TRACE_ENTRY();
+
+			result = !m_size;
+
+			TRACE_EXIT_FORMAT("Result=%x", result);
+			return result;
+		}
+
+		void
+		mapping::map(
+			__in const std::string &path
+			)
+		{
+			TRACE_ENTRY_FORMAT("Path[%u]=%s", path.size(), STRING(path));
+
+			TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "File mapping", "%s", STRING(path));
+
+			unmap();
+#ifdef __linux__
+			int file;
+			struct stat status = {};
+
+			file = open(STRING(path), O_RDONLY);
+			if(file < 0) {
+				THROW_C65_TYPE_MAPPING_EXCEPTION_FORMAT(C65_TYPE_MAPPING_EXCEPTION_FILE_NOT_FOUND, "%s", STRING(path));
+			}
+
+			if(fstat(file, &status)) {
+				close(file);
+				THROW_C65_TYPE_MAPPING_EXCEPTION_FORMAT(C65_TYPE_MAPPING_EXCEPTION_FILE_MALFORMED, "%s", STRING(path));
+			}
+
+			if(status.st_size > 0) {
+				void *map = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+				if(map == MAP_FAILED) {
+					close(file);
+					THROW_C65_TYPE_MAPPING_EXCEPTION_FORMAT(C65_TYPE_MAPPING_EXCEPTION_FILE_UNMAPPABLE, "%s", STRING(path));
+				}
+
+				m_data = (const c65_byte_t *)map;
+				m_size = status.st_size;
+			}
+
+			close(file);
+#else
+			m_buffer.load(path);
+			m_data = m_buffer.data();
+			m_size = m_buffer.size();
+#endif // __linux__
+
+			TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "File mapped", "%.02f KB (%u bytes)", m_size / (float)std::kilo::num, m_size);
+
+			TRACE_EXIT();
+		}
+
+		bool
+		mapping::mapped(void) const
+		{
+			bool result;
+
+			TRACE_ENTRY();
+
+			result = (m_data != nullptr);
+
+			TRACE_EXIT_FORMAT("Result=%x", result);
+			return result;
+		}
+
+		size_t
+		mapping::size(void) const
+		{
+			TRACE_ENTRY();
+			TRACE_EXIT_FORMAT("Result=%u", m_size);
+			return m_size;
+		}
+
+		void
+		mapping::unmap(void)
+		{
+			TRACE_ENTRY();
+
+			if(m_data) {
+#ifdef __linux__
+				munmap((void *)m_data, m_size);
+#else
+				m_buffer.clear();
+#endif // __linux__
+				m_data = nullptr;
+				m_size = 0;
+			}
+
+			TRACE_EXIT();
+		}
+	}
+}
@@ -54,19 +54,35 @@ namespace c65 {
 
 				void test_action(void);
 
+				void test_attribute(void);
+
+				void test_breakpoint(void);
+
 				void test_event_handler(void);
 
+				void test_event_ring(void);
+
 				void test_cleanup(void);
 
 				void test_interrupt(void);
 
 				void test_load(void);
 
+				void test_memory_view(void);
+
+				void test_read_block(void);
+
+				void test_region(void);
+
 				void test_reset(void);
 
 				void test_step(void);
 
 				void test_unload(void);
+
+				void test_watch(void);
+
+				void test_write_block(void);
 		};
 	}
 }
@@ -54,6 +54,10 @@ namespace c65 {
 
 					void on_teardown(void) override;
 
+					void test_bank(void);
+
+					void test_data(void);
+
 					void test_read(void);
 
 					void test_write(void);
@@ -79,6 +79,8 @@ namespace c65 {
 
 					void test_execute_add(void);
 
+					void test_execute_add_decimal(void);
+
 					void test_execute_and(void);
 
 					void test_execute_bit(void);
@@ -153,6 +155,8 @@ namespace c65 {
 
 					void test_execute_subtract(void);
 
+					void test_execute_subtract_decimal(void);
+
 					void test_execute_test_reset_bit(void);
 
 					void test_execute_test_set_bit(void);
@@ -167,31 +171,51 @@ namespace c65 {
 
 					void test_interrupt_pending(void);
 
+					void test_invalidate(void);
+
 					void test_read(void);
 
+					void test_read_engine(void);
+
 					void test_read_register(void);
 
 					void test_read_status(void);
 
+					void test_read_timing(void);
+
 					void test_reset(void);
 
+					void test_run(void);
+
 					void test_stack_overflow(void);
 
 					void test_stack_underflow(void);
 
 					void test_step(void);
 
+					void test_step_block(void);
+
 					void test_stopped(void);
 
 					void test_waiting(void);
 
 					void test_write(void);
 
+					void test_write_engine(void);
+
 					void test_write_register(void);
 
 					void test_write_status(void);
 
+					void test_write_timing(void);
+
+					mutable uint32_t m_access;
+
+					mutable std::vector<uint32_t> m_elapsed;
+
 					std::vector<c65_byte_t> m_memory;
+
+					mutable std::vector<c65_word_t> m_sequence;
 			};
 		}
 	}
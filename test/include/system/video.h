@@ -56,6 +56,12 @@ namespace c65 {
 
 					void test_clear(void);
 
+					void test_data(void);
+
+					void test_fill(void);
+
+					void test_load(void);
+
 					void test_read(void);
 
 					void test_write(void);
@@ -19,6 +19,18 @@
 #include "../include/c65.h"
 #include "./c65_type.h"
 
+static int EVENT_COUNT = 0;
+
+static c65_event_t EVENT_LAST = {};
+
+static void c65_event_counter(
+	__in const c65_event_t *event
+	)
+{
+	++EVENT_COUNT;
+	EVENT_LAST = *event;
+}
+
 static void c65_event_handler(
 	__in const c65_event_t *event
 	)
@@ -50,13 +62,21 @@ namespace c65 {
 			TRACE_ENTRY_FORMAT("Quiet=%x", quiet);
 
 			EXECUTE_TEST(test_action, quiet);
+			EXECUTE_TEST(test_attribute, quiet);
+			EXECUTE_TEST(test_breakpoint, quiet);
 			EXECUTE_TEST(test_cleanup, quiet);
 			EXECUTE_TEST(test_event_handler, quiet);
+			EXECUTE_TEST(test_event_ring, quiet);
 			EXECUTE_TEST(test_interrupt, quiet);
 			EXECUTE_TEST(test_load, quiet);
+			EXECUTE_TEST(test_memory_view, quiet);
+			EXECUTE_TEST(test_read_block, quiet);
+			EXECUTE_TEST(test_region, quiet);
 			EXECUTE_TEST(test_reset, quiet);
 			EXECUTE_TEST(test_step, quiet);
 			EXECUTE_TEST(test_unload, quiet);
+			EXECUTE_TEST(test_watch, quiet);
+			EXECUTE_TEST(test_write_block, quiet);
 
 			TRACE_EXIT();
 		}
@@ -331,6 +351,408 @@ namespace c65 {
 			ASSERT(response.data.word == value.word);
 			ASSERT(c65_unload(address, INSTRUCTION_LENGTH_WORD) == EXIT_SUCCESS);
 
+			// Test #19: Read engine action
+			request.type = C65_ACTION_READ_ENGINE;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.type == C65_ACTION_READ_ENGINE);
+			ASSERT(response.data.word == C65_ENGINE_INTERPRETER);
+
+			// Test #20: Write engine action
+			for(type = 0; type <= C65_ENGINE_MAX; ++type) {
+				request.type = C65_ACTION_WRITE_ENGINE;
+				request.data.word = type;
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+				ASSERT(response.type == C65_ACTION_WRITE_ENGINE);
+
+				request.type = C65_ACTION_READ_ENGINE;
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+				ASSERT(response.type == C65_ACTION_READ_ENGINE);
+				ASSERT(response.data.word == type);
+			}
+
+			request.type = C65_ACTION_WRITE_ENGINE;
+			request.data.word = (C65_ENGINE_MAX + 1);
+			ASSERT(c65_action(&request, &response) == EXIT_FAILURE);
+			ASSERT(response.type == C65_ACTION_WRITE_ENGINE);
+
+			request.data.word = C65_ENGINE_INTERPRETER;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			// Test #21: Read timing action
+			request.type = C65_ACTION_READ_TIMING;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.type == C65_ACTION_READ_TIMING);
+			ASSERT(response.data.word == C65_TIMING_FAST);
+
+			// Test #22: Write timing action
+			for(type = 0; type <= C65_TIMING_MAX; ++type) {
+				request.type = C65_ACTION_WRITE_TIMING;
+				request.data.word = type;
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+				ASSERT(response.type == C65_ACTION_WRITE_TIMING);
+
+				request.type = C65_ACTION_READ_TIMING;
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+				ASSERT(response.type == C65_ACTION_READ_TIMING);
+				ASSERT(response.data.word == type);
+			}
+
+			request.type = C65_ACTION_WRITE_TIMING;
+			request.data.word = (C65_TIMING_MAX + 1);
+			ASSERT(c65_action(&request, &response) == EXIT_FAILURE);
+			ASSERT(response.type == C65_ACTION_WRITE_TIMING);
+
+			request.data.word = C65_TIMING_FAST;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			// Test #23: Read attribute action
+			request.type = C65_ACTION_READ_ATTRIBUTE;
+			request.address.word = ADDRESS_MEMORY_HIGH_BEGIN;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.type == C65_ACTION_READ_ATTRIBUTE);
+			ASSERT(response.data.word == 0);
+
+			// Test #24: Write attribute action
+			request.type = C65_ACTION_WRITE_ATTRIBUTE;
+			request.address.word = ADDRESS_MEMORY_HIGH_BEGIN;
+			request.data.word = MASK(C65_ATTRIBUTE_READ_ONLY);
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.type == C65_ACTION_WRITE_ATTRIBUTE);
+
+			request.type = C65_ACTION_READ_ATTRIBUTE;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.word == MASK(C65_ATTRIBUTE_READ_ONLY));
+
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.data.low = (MEMORY_FILL + 1);
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			request.type = C65_ACTION_READ_BYTE;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.low == MEMORY_FILL);
+
+			value.low = (MEMORY_FILL + 1);
+			ASSERT(c65_load(&value.low, sizeof(value.low), request.address) == EXIT_SUCCESS);
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.low == value.low);
+			ASSERT(c65_unload(request.address, sizeof(value.low)) == EXIT_SUCCESS);
+
+			request.type = C65_ACTION_WRITE_ATTRIBUTE;
+			request.data.word = (ATTRIBUTE_MASK + 1);
+			ASSERT(c65_action(&request, &response) == EXIT_FAILURE);
+			ASSERT(response.type == C65_ACTION_WRITE_ATTRIBUTE);
+
+			request.data.word = 0;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			// Test #25: Read banking action
+			request.type = C65_ACTION_READ_BANKING;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.type == C65_ACTION_READ_BANKING);
+			ASSERT(!response.data.word);
+
+			// Test #26: Write banking action
+			request.type = C65_ACTION_WRITE_BANKING;
+			request.data.word = true;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.type == C65_ACTION_WRITE_BANKING);
+
+			request.type = C65_ACTION_READ_BANKING;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.word);
+
+			request.type = C65_ACTION_WRITE_BANKING;
+			request.data.word = false;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			TRACE_EXIT();
+		}
+
+		void
+		runtime::test_attribute(void)
+		{
+			c65_region_t region = {};
+			c65_address_t address = {}, target = {};
+			c65_action_t request = {}, response = {};
+			std::vector<c65_byte_t> data(ADDRESS_PAGE_LENGTH, MEMORY_ZERO);
+			const c65_byte_t program[] = { 0xa9, 0x55, 0x8d, 0x00, 0x00 }; // LDA #$55; STA target
+
+			TRACE_ENTRY();
+
+			ASSERT(c65_reset() == EXIT_SUCCESS);
+			ASSERT(c65_event_handler(C65_EVENT_PROTECTION_FAULT, c65_event_counter) == EXIT_SUCCESS);
+
+			address.word = ADDRESS_MEMORY_HIGH_BEGIN;
+			target.word = (address.word + ADDRESS_PAGE_LENGTH);
+			std::vector<c65_byte_t> code(program, program + sizeof(program));
+			code.at(3) = target.low;
+			code.at(4) = target.high;
+			ASSERT(c65_load(code.data(), code.size(), address) == EXIT_SUCCESS);
+
+			// Test #1: Read-only write
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.address = target;
+			request.data.low = MEMORY_ZERO;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.type = C65_ACTION_WRITE_ATTRIBUTE;
+			request.data.word = MASK(C65_ATTRIBUTE_READ_ONLY);
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.type = C65_ACTION_WRITE_REGISTER;
+			request.address.word = C65_REGISTER_PROGRAM_COUNTER;
+			request.data.word = address.word;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			EVENT_COUNT = 0;
+			ASSERT(c65_step() == EXIT_SUCCESS);
+			ASSERT(c65_step() == EXIT_SUCCESS);
+			ASSERT(EVENT_COUNT == 1);
+			ASSERT(EVENT_LAST.type == C65_EVENT_PROTECTION_FAULT);
+			ASSERT(EVENT_LAST.address.word == target.word);
+			ASSERT(EVENT_LAST.data.word == MASK(C65_ATTRIBUTE_READ_ONLY));
+
+			request.type = C65_ACTION_READ_BYTE;
+			request.address = target;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.low == MEMORY_ZERO);
+			request.type = C65_ACTION_WRITE_ATTRIBUTE;
+			request.data.word = 0;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			// Test #2: No-execute fetch
+			request.type = C65_ACTION_WRITE_ATTRIBUTE;
+			request.address = address;
+			request.data.word = MASK(C65_ATTRIBUTE_NO_EXECUTE);
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.type = C65_ACTION_WRITE_REGISTER;
+			request.address.word = C65_REGISTER_PROGRAM_COUNTER;
+			request.data.word = address.word;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.address.word = C65_REGISTER_ACCUMULATOR;
+			request.data.word = MEMORY_ZERO;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			EVENT_COUNT = 0;
+			ASSERT(c65_step() == EXIT_SUCCESS);
+			ASSERT(c65_step() == EXIT_SUCCESS);
+			ASSERT(EVENT_COUNT == 1);
+			ASSERT(EVENT_LAST.address.word == address.word);
+			ASSERT(EVENT_LAST.data.word == MASK(C65_ATTRIBUTE_NO_EXECUTE));
+
+			request.type = C65_ACTION_READ_REGISTER;
+			request.address.word = C65_REGISTER_PROGRAM_COUNTER;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.word == address.word);
+			request.address.word = C65_REGISTER_ACCUMULATOR;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.low == MEMORY_ZERO);
+
+			request.type = C65_ACTION_WRITE_ATTRIBUTE;
+			request.address = address;
+			request.data.word = 0;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(c65_reset() == EXIT_SUCCESS);
+
+			// Test #3: Memory-mapped IO code
+			data.at(0) = INSTRUCTION_TYPE_LDA_IMMEDIATE;
+			data.at(2) = INSTRUCTION_TYPE_BRA_RELATIVE;
+			data.at(3) = 0xfc;
+			region.data = &data[0];
+			address.word = 0x1000;
+			ASSERT(c65_region(address, data.size(), &region) == EXIT_SUCCESS);
+			request.type = C65_ACTION_WRITE_ATTRIBUTE;
+			request.address = address;
+			request.data.word = MASK(C65_ATTRIBUTE_MMIO);
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.type = C65_ACTION_WRITE_REGISTER;
+			request.address.word = C65_REGISTER_PROGRAM_COUNTER;
+			request.data.word = address.word;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			for(int index = 0; index < 2; ++index) {
+				data.at(1) = (0x40 + index);
+				ASSERT(c65_step() == EXIT_SUCCESS);
+				request.type = C65_ACTION_READ_REGISTER;
+				request.address.word = C65_REGISTER_ACCUMULATOR;
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+				ASSERT(response.data.low == data.at(1));
+				ASSERT(c65_step() == EXIT_SUCCESS);
+			}
+
+			request.type = C65_ACTION_WRITE_ATTRIBUTE;
+			request.address = address;
+			request.data.word = 0;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(c65_region(address, data.size(), nullptr) == EXIT_SUCCESS);
+
+			TRACE_EXIT();
+		}
+
+		void
+		runtime::test_breakpoint(void)
+		{
+			int step;
+			c65_watch_t watch = {};
+			c65_address_t address = {};
+			c65_action_t request = {}, response = {};
+			const c65_byte_t program[] = { 0xe8, 0x4c, 0x00, 0x00 }; // INX; JMP base
+
+			TRACE_ENTRY();
+
+			address.word = ADDRESS_MEMORY_HIGH_BEGIN;
+			std::vector<c65_byte_t> data(program, program + sizeof(program));
+			data.at(2) = address.low;
+			data.at(3) = address.high;
+			ASSERT(c65_write_block(data.data(), data.size(), address) == EXIT_SUCCESS);
+			ASSERT(c65_event_handler(C65_EVENT_BREAKPOINT, c65_event_counter) == EXIT_SUCCESS);
+
+			request.type = C65_ACTION_BREAKPOINT_CLEAR;
+			request.address.word = address.word;
+			c65_action(&request, &response);
+			request.address.word = (address.word + 1);
+			c65_action(&request, &response);
+
+			// Test #1: Register condition
+			request.type = C65_ACTION_WRITE_REGISTER;
+			request.address.word = C65_REGISTER_INDEX_X;
+			request.data.word = 0;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.address.word = C65_REGISTER_PROGRAM_COUNTER;
+			request.data.word = address.word;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			request.type = C65_ACTION_BREAKPOINT_SET;
+			request.address.word = address.word;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.type = C65_ACTION_BREAKPOINT_CONDITION;
+			request.condition.type = C65_CONDITION_REGISTER;
+			request.condition.compare = C65_COMPARE_EQUAL;
+			request.condition.operand = C65_REGISTER_INDEX_X;
+			request.condition.value = 3;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.type == C65_ACTION_BREAKPOINT_CONDITION);
+
+			EVENT_COUNT = 0;
+
+			for(step = 0; step < 7; ++step) {
+				ASSERT(c65_step() == EXIT_SUCCESS);
+			}
+
+			ASSERT(EVENT_COUNT == 1);
+			request.type = C65_ACTION_READ_REGISTER;
+			request.address.word = C65_REGISTER_INDEX_X;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.low == 3);
+			request.address.word = C65_REGISTER_PROGRAM_COUNTER;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.word == address.word);
+
+			request.type = C65_ACTION_BREAKPOINT_CLEAR;
+			request.address.word = address.word;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			// Test #2: Hit condition
+			request.type = C65_ACTION_BREAKPOINT_SET;
+			request.address.word = (address.word + 1);
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.type = C65_ACTION_BREAKPOINT_CONDITION;
+			request.condition.type = C65_CONDITION_HIT;
+			request.condition.compare = C65_COMPARE_EQUAL;
+			request.condition.operand = 0;
+			request.condition.value = 2;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			EVENT_COUNT = 0;
+
+			for(step = 0; step < 4; ++step) {
+				ASSERT(c65_step() == EXIT_SUCCESS);
+			}
+
+			ASSERT(EVENT_COUNT == 1);
+			request.type = C65_ACTION_READ_REGISTER;
+			request.address.word = C65_REGISTER_INDEX_X;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.low == 5);
+
+			ASSERT(c65_step() == EXIT_SUCCESS);
+			request.address.word = C65_REGISTER_PROGRAM_COUNTER;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.word == address.word);
+			ASSERT(EVENT_COUNT == 1);
+
+			// Test #3: Memory and status conditions
+			request.type = C65_ACTION_BREAKPOINT_CLEAR;
+			request.address.word = (address.word + 1);
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.type = C65_ACTION_BREAKPOINT_SET;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.type = C65_ACTION_BREAKPOINT_CONDITION;
+			request.condition.type = C65_CONDITION_MEMORY;
+			request.condition.compare = C65_COMPARE_GREATER_EQUAL;
+			request.condition.operand = (address.word + ADDRESS_PAGE_LENGTH);
+			request.condition.value = MEMORY_FILL;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.condition.type = C65_CONDITION_STATUS;
+			request.condition.compare = C65_COMPARE_NOT_EQUAL;
+			request.condition.operand = MASK(FLAG_NEGATIVE);
+			request.condition.value = 0;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.address.word = (address.word + ADDRESS_PAGE_LENGTH);
+			request.data.low = MEMORY_ZERO;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			watch.type = MASK(C65_WATCH_READ);
+			ASSERT(c65_watch(request.address, 1, &watch) == EXIT_SUCCESS);
+			ASSERT(c65_event_handler(C65_EVENT_WATCH_READ, c65_event_counter) == EXIT_SUCCESS);
+
+			EVENT_COUNT = 0;
+
+			for(step = 0; step < 4; ++step) {
+				ASSERT(c65_step() == EXIT_SUCCESS);
+			}
+
+			ASSERT(!EVENT_COUNT);
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.data.low = MEMORY_FILL;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.type = C65_ACTION_WRITE_REGISTER;
+			request.address.word = C65_REGISTER_INDEX_X;
+			request.data.word = 0x7f;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			for(step = 0; step < 4; ++step) {
+				ASSERT(c65_step() == EXIT_SUCCESS);
+			}
+
+			ASSERT(EVENT_COUNT);
+			request.type = C65_ACTION_READ_REGISTER;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.low == 0x80);
+			ASSERT(c65_event_handler(C65_EVENT_WATCH_READ, nullptr) == EXIT_SUCCESS);
+			request.address.word = (address.word + ADDRESS_PAGE_LENGTH);
+			ASSERT(c65_watch(request.address, 1, nullptr) == EXIT_SUCCESS);
+
+			// Test #4: Invalid condition
+			request.type = C65_ACTION_BREAKPOINT_CONDITION;
+			request.address.word = (address.word + 1);
+			request.condition.type = (C65_CONDITION_MAX + 1);
+			ASSERT(c65_action(&request, &response) == EXIT_FAILURE);
+			request.condition.type = C65_CONDITION_HIT;
+			request.condition.compare = (C65_COMPARE_MAX + 1);
+			ASSERT(c65_action(&request, &response) == EXIT_FAILURE);
+			request.condition.type = C65_CONDITION_REGISTER;
+			request.condition.compare = C65_COMPARE_EQUAL;
+			request.condition.operand = (C65_REGISTER_MAX + 1);
+			ASSERT(c65_action(&request, &response) == EXIT_FAILURE);
+			request.condition.operand = C65_REGISTER_INDEX_X;
+			request.address.word = address.word;
+			ASSERT(c65_action(&request, &response) == EXIT_FAILURE);
+
+			request.type = C65_ACTION_BREAKPOINT_CLEAR;
+			request.address.word = (address.word + 1);
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(c65_event_handler(C65_EVENT_BREAKPOINT, nullptr) == EXIT_SUCCESS);
+
 			TRACE_EXIT();
 		}
 
@@ -364,6 +786,87 @@ namespace c65 {
 			TRACE_EXIT();
 		}
 
+		void
+		runtime::test_event_ring(void)
+		{
+			c65_watch_t watch = {};
+			c65_address_t address = {};
+			c65_dword_t count, overflow;
+			c65_action_t request = {}, response = {};
+			std::vector<c65_event_entry_t> entry(C65_EVENT_RING_LENGTH * 2);
+
+			TRACE_ENTRY();
+
+			ASSERT(c65_event_handler(C65_EVENT_WATCH, c65_event_counter) == EXIT_SUCCESS);
+			address.word = ADDRESS_MEMORY_HIGH_BEGIN;
+			watch.type = MASK(C65_WATCH_WRITE);
+			ASSERT(c65_watch(address, ADDRESS_PAGE_LENGTH, &watch) == EXIT_SUCCESS);
+			ASSERT(c65_event_ring(true) == EXIT_SUCCESS);
+
+			// Test #1: Drain ring in batches
+			EVENT_COUNT = 0;
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.data.low = MEMORY_FILL;
+
+			for(request.address.word = ADDRESS_MEMORY_HIGH_BEGIN; request.address.word < (ADDRESS_MEMORY_HIGH_BEGIN + 3);
+					++request.address.word) {
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			}
+
+			ASSERT(!EVENT_COUNT);
+			count = 2;
+			ASSERT(c65_event_drain(entry.data(), &count, &overflow) == EXIT_SUCCESS);
+			ASSERT(count == 2);
+			ASSERT(!overflow);
+
+			for(c65_dword_t index = 0; index < count; ++index) {
+				ASSERT(entry.at(index).event.type == C65_EVENT_WATCH);
+				ASSERT(entry.at(index).event.address.word == (ADDRESS_MEMORY_HIGH_BEGIN + index));
+			}
+
+			count = entry.size();
+			ASSERT(c65_event_drain(entry.data(), &count, nullptr) == EXIT_SUCCESS);
+			ASSERT(count == 1);
+			ASSERT(entry.at(0).event.address.word == (ADDRESS_MEMORY_HIGH_BEGIN + 2));
+
+			count = entry.size();
+			ASSERT(c65_event_drain(entry.data(), &count, nullptr) == EXIT_SUCCESS);
+			ASSERT(!count);
+
+			// Test #2: Ring overflow
+			request.address.word = ADDRESS_MEMORY_HIGH_BEGIN;
+
+			for(c65_dword_t index = 0; index < (C65_EVENT_RING_LENGTH + 5); ++index) {
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			}
+
+			count = entry.size();
+			ASSERT(c65_event_drain(entry.data(), &count, &overflow) == EXIT_SUCCESS);
+			ASSERT(count == C65_EVENT_RING_LENGTH);
+			ASSERT(overflow == 5);
+
+			// Test #3: Disable ring
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(c65_event_ring(false) == EXIT_SUCCESS);
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(EVENT_COUNT == 1);
+			count = entry.size();
+			ASSERT(c65_event_drain(entry.data(), &count, nullptr) == EXIT_SUCCESS);
+			ASSERT(count == 1);
+			count = entry.size();
+			ASSERT(c65_event_drain(entry.data(), &count, nullptr) == EXIT_SUCCESS);
+			ASSERT(!count);
+
+			// Test #4: Invalid drain
+			ASSERT(c65_event_drain(entry.data(), nullptr, nullptr) == EXIT_FAILURE);
+			ASSERT(c65_event_drain(nullptr, &count, nullptr) == EXIT_FAILURE);
+
+			ASSERT(c65_watch(address, ADDRESS_PAGE_LENGTH, nullptr) == EXIT_SUCCESS);
+			ASSERT(c65_event_handler(C65_EVENT_WATCH, nullptr) == EXIT_SUCCESS);
+
+			TRACE_EXIT();
+		}
+
 		void
 		runtime::test_interrupt(void)
 		{
@@ -386,6 +889,7 @@ namespace c65 {
 		runtime::test_load(void)
 		{
 			std::vector<c65_byte_t> data;
+			c65_action_t request = {}, response = {};
 			c65_address_t address = {}, length = {};
 
 			TRACE_ENTRY();
@@ -423,9 +927,332 @@ namespace c65 {
 				ASSERT(false);
 			} catch(...) { }
 
+			// Test #3: Bank load
+			address.word = ADDRESS_MEMORY_BANK_BEGIN;
+			ASSERT(c65_load_bank((c65_byte_t *)&data[0], MEMORY_BANK_LENGTH, address, MEMORY_BANK_COUNT) == EXIT_FAILURE);
+
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.address.word = ADDRESS_MEMORY_BANK;
+			request.data.low = MEMORY_BANK_COUNT;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			request.type = C65_ACTION_READ_BYTE;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.low == MEMORY_BANK_COUNT);
+
+			request.address = address;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.low == data.at(address.word - ADDRESS_MEMORY_HIGH_BEGIN));
+
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.address.word = ADDRESS_MEMORY_BANK;
+			request.data.low = MEMORY_ZERO;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			request.type = C65_ACTION_WRITE_BANKING;
+			request.data.word = true;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			ASSERT(c65_load_bank((c65_byte_t *)&data[0], MEMORY_BANK_LENGTH, address, MEMORY_BANK_COUNT) == EXIT_SUCCESS);
+
+			for(address.word = ADDRESS_MEMORY_BANK_BEGIN; address.word <= ADDRESS_MEMORY_BANK_END; ++address.word) {
+				c65_action_t request = {}, response = {};
+
+				request.type = C65_ACTION_READ_BYTE;
+				request.address = address;
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+				ASSERT(response.data.low == data.at(address.word - ADDRESS_MEMORY_HIGH_BEGIN));
+			}
+
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.address.word = ADDRESS_MEMORY_BANK;
+			request.data.low = MEMORY_BANK_COUNT;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			for(address.word = ADDRESS_MEMORY_BANK_BEGIN; address.word <= ADDRESS_MEMORY_BANK_END; ++address.word) {
+				request.type = C65_ACTION_READ_BYTE;
+				request.address = address;
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+				ASSERT(response.data.low == data.at(address.word - ADDRESS_MEMORY_BANK_BEGIN));
+			}
+
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.address.word = ADDRESS_MEMORY_BANK;
+			request.data.low = 0;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			address.word = ADDRESS_MEMORY_BANK_BEGIN;
+			ASSERT(c65_unload_bank(address, MEMORY_BANK_LENGTH, MEMORY_BANK_COUNT) == EXIT_SUCCESS);
 			address.word = ADDRESS_MEMORY_HIGH_BEGIN;
 			ASSERT(c65_unload(address, length.word) == EXIT_SUCCESS);
 
+			// Test #4: Invalid bank load
+			address.word = (ADDRESS_MEMORY_BANK_BEGIN - 1);
+			ASSERT(c65_load_bank((c65_byte_t *)&data[0], 2, address, MEMORY_BANK_COUNT) == EXIT_FAILURE);
+			ASSERT(c65_unload_bank(address, 2, MEMORY_BANK_COUNT) == EXIT_FAILURE);
+			address.word = ADDRESS_MEMORY_BANK_END;
+			ASSERT(c65_load_bank((c65_byte_t *)&data[0], 2, address, MEMORY_BANK_COUNT) == EXIT_FAILURE);
+			ASSERT(c65_unload_bank(address, 2, MEMORY_BANK_COUNT) == EXIT_FAILURE);
+			request.type = C65_ACTION_READ_BYTE;
+			request.address.word = ADDRESS_MEMORY_BANK;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.low == 0);
+
+			request.type = C65_ACTION_WRITE_BANKING;
+			request.data.word = false;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			// Test #5: Video load
+			address.word = ADDRESS_VIDEO_BEGIN;
+			ASSERT(c65_load((c65_byte_t *)&data[0], ADDRESS_LENGTH(ADDRESS_VIDEO_BEGIN, ADDRESS_VIDEO_END), address)
+				== EXIT_SUCCESS);
+
+			for(; address.word <= ADDRESS_VIDEO_END; ++address.word) {
+				request.type = C65_ACTION_READ_BYTE;
+				request.address = address;
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+				ASSERT(response.data.low == data.at(address.word - ADDRESS_VIDEO_BEGIN));
+			}
+
+			address.word = ADDRESS_VIDEO_BEGIN;
+			ASSERT(c65_unload(address, ADDRESS_LENGTH(ADDRESS_VIDEO_BEGIN, ADDRESS_VIDEO_END)) == EXIT_SUCCESS);
+			ASSERT(c65_read_block((c65_byte_t *)&data[0], ADDRESS_LENGTH(ADDRESS_VIDEO_BEGIN, ADDRESS_VIDEO_END), address)
+				== EXIT_SUCCESS);
+
+			for(; address.word <= ADDRESS_VIDEO_END; ++address.word) {
+				ASSERT(data.at(address.word - ADDRESS_VIDEO_BEGIN) == MEMORY_ZERO);
+			}
+
+			TRACE_EXIT();
+		}
+
+		void
+		runtime::test_memory_view(void)
+		{
+			c65_memory_view_t view = {};
+			c65_address_t address = {};
+			c65_action_t request = {}, response = {};
+
+			TRACE_ENTRY();
+
+			// Test #1: Memory view
+			ASSERT(c65_memory_view(&view) == EXIT_SUCCESS);
+			ASSERT(view.zero_page && view.stack && view.video && view.high && view.dirty);
+
+			address.word = (ADDRESS_MEMORY_HIGH_BEGIN + ADDRESS_PAGE_LENGTH);
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.address = address;
+			request.data.low = (MEMORY_FILL + 1);
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(view.high[address.word - ADDRESS_MEMORY_HIGH_BEGIN] == request.data.low);
+
+			address.word = ADDRESS_VIDEO_BEGIN;
+			request.address = address;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(view.video[address.word - ADDRESS_VIDEO_BEGIN] == request.data.low);
+
+			// Test #2: Dirty pages
+			std::memset(view.dirty, 0, C65_MEMORY_VIEW_DIRTY_LENGTH * sizeof(*view.dirty));
+
+			address.word = (ADDRESS_MEMORY_HIGH_BEGIN + ADDRESS_PAGE_LENGTH);
+			ASSERT(c65_unload(address, INSTRUCTION_LENGTH_BYTE) == EXIT_SUCCESS);
+			ASSERT(view.dirty[address.high / 32] == (1U << (address.high % 32)));
+
+			view.dirty[address.high / 32] = 0;
+
+			address.word = ADDRESS_VIDEO_BEGIN;
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.address = address;
+			request.data.low = MEMORY_ZERO;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(view.dirty[address.high / 32] == (1U << (address.high % 32)));
+
+			view.dirty[address.high / 32] = 0;
+
+			for(address.word = 0; address.word < C65_MEMORY_VIEW_DIRTY_LENGTH; ++address.word) {
+				ASSERT(!view.dirty[address.word]);
+			}
+
+			// Test #3: Invalid view
+			ASSERT(c65_memory_view(nullptr) == EXIT_FAILURE);
+
+			TRACE_EXIT();
+		}
+
+		void
+		runtime::test_read_block(void)
+		{
+			int count = 0;
+			c65_region_t region = {};
+			std::vector<c65_byte_t> data, result;
+			c65_address_t address = {}, length = {};
+			c65_action_t request = {}, response = {};
+
+			TRACE_ENTRY();
+
+			length.word = (ADDRESS_PAGE_LENGTH * 2);
+			data.resize(length.word, MEMORY_ZERO);
+			result.resize(length.word, MEMORY_ZERO);
+
+			for(address.word = 0; address.word < length.word; ++address.word) {
+				data.at(address.word) = std::rand();
+			}
+
+			// Test #1: Valid read
+			address.word = (ADDRESS_MEMORY_HIGH_BEGIN + (ADDRESS_PAGE_LENGTH / 2));
+			ASSERT(c65_load((c65_byte_t *)&data[0], length.word, address) == EXIT_SUCCESS);
+			ASSERT(c65_read_block((c65_byte_t *)&result[0], length.word, address) == EXIT_SUCCESS);
+			ASSERT(result == data);
+			ASSERT(c65_unload(address, length.word) == EXIT_SUCCESS);
+
+			// Test #2: Device read
+			address.word = ADDRESS_MEMORY_BANK;
+			ASSERT(c65_read_block((c65_byte_t *)&result[0], ADDRESS_KEY - ADDRESS_MEMORY_BANK + 1, address) == EXIT_SUCCESS);
+			ASSERT(result.front() == 0);
+
+			// Test #3: Wrapping read
+			address.word = (UINT16_MAX - (ADDRESS_PAGE_LENGTH / 2) + 1);
+			ASSERT(c65_read_block((c65_byte_t *)&result[0], ADDRESS_PAGE_LENGTH, address) == EXIT_SUCCESS);
+
+			for(length.word = 0; length.word < ADDRESS_PAGE_LENGTH; ++length.word, ++address.word) {
+				request.type = C65_ACTION_READ_BYTE;
+				request.address = address;
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+				ASSERT(response.data.low == result.at(length.word));
+			}
+
+			// Test #4: Handler region read
+			region.context = &count;
+			region.read = [](void *context, c65_address_t address) -> c65_byte_t {
+					return ++*(int *)context;
+				};
+			address.word = 0x1000;
+			ASSERT(c65_region(address, ADDRESS_PAGE_LENGTH, &region) == EXIT_SUCCESS);
+			ASSERT(c65_read_block((c65_byte_t *)&result[0], ADDRESS_PAGE_LENGTH, address) == EXIT_SUCCESS);
+			request.type = C65_ACTION_READ_BYTE;
+			request.address = address;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.type = C65_ACTION_READ_WORD;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(!count);
+			ASSERT(c65_region(address, ADDRESS_PAGE_LENGTH, nullptr) == EXIT_SUCCESS);
+
+			TRACE_EXIT();
+		}
+
+		void
+		runtime::test_region(void)
+		{
+			c65_region_t region = {};
+			c65_address_t address = {};
+			c65_action_t request = {}, response = {};
+			std::vector<c65_byte_t> data(ADDRESS_LENGTH(0x1000, 0x11ff), MEMORY_ZERO), device(1, MEMORY_ZERO);
+
+			TRACE_ENTRY();
+
+			// Test #1: Data region
+			region.data = &data[0];
+			address.word = 0x1000;
+			ASSERT(c65_region(address, data.size(), &region) == EXIT_SUCCESS);
+
+			for(address.word = 0x1000; address.word <= 0x11ff; ++address.word) {
+				data.at(address.word - 0x1000) = std::rand();
+				request.type = C65_ACTION_READ_BYTE;
+				request.address = address;
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+				ASSERT(response.data.low == data.at(address.word - 0x1000));
+				request.type = C65_ACTION_WRITE_BYTE;
+				request.data.low = ~response.data.low;
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+				ASSERT(data.at(address.word - 0x1000) == request.data.low);
+			}
+
+			// Test #2: Handler region
+			region = {};
+			region.context = &device[0];
+			region.read = [](void *context, c65_address_t address) -> c65_byte_t {
+					return *(c65_byte_t *)context + address.low;
+				};
+			region.write = [](void *context, c65_address_t address, c65_byte_t value) {
+					*(c65_byte_t *)context = value;
+				};
+			address.word = 0x1000;
+			ASSERT(c65_region(address, ADDRESS_PAGE_LENGTH, &region) == EXIT_SUCCESS);
+
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.address.word = 0x1010;
+			request.data.low = 0x20;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(device.at(0) == 0x20);
+			request.type = C65_ACTION_READ_BYTE;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.low == MEMORY_ZERO);
+
+			// Test #3: Handler region code
+			region.read = [](void *context, c65_address_t address) -> c65_byte_t {
+					return ((address.low == UINT8_MAX) ? *(c65_byte_t *)context : INSTRUCTION_TYPE_LDA_IMMEDIATE);
+				};
+			ASSERT(c65_region(address, ADDRESS_PAGE_LENGTH, &region) == EXIT_SUCCESS);
+			ASSERT(c65_reset() == EXIT_SUCCESS);
+			data.at(0x100) = INSTRUCTION_TYPE_BRA_RELATIVE;
+			data.at(0x101) = 0xfc;
+			request.type = C65_ACTION_WRITE_REGISTER;
+			request.address.word = C65_REGISTER_PROGRAM_COUNTER;
+			request.data.word = (address.word + ADDRESS_PAGE_LENGTH - 2);
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			for(int index = 0; index < 2; ++index) {
+				device.at(0) = (0x40 + index);
+				ASSERT(c65_step() == EXIT_SUCCESS);
+				request.type = C65_ACTION_READ_REGISTER;
+				request.address.word = C65_REGISTER_ACCUMULATOR;
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+				ASSERT(response.data.low == device.at(0));
+				ASSERT(c65_step() == EXIT_SUCCESS);
+			}
+
+			// Test #4: Data region with a read handler
+			region.data = &data[0];
+			ASSERT(c65_region(address, ADDRESS_PAGE_LENGTH, &region) == EXIT_SUCCESS);
+			request.type = C65_ACTION_READ_BYTE;
+			request.address.word = 0x1010;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.low == data.at(0x10));
+
+			// Test #5: Restore region
+			address.word = 0x1000;
+			ASSERT(c65_region(address, data.size(), nullptr) == EXIT_SUCCESS);
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.address.word = 0x1100;
+			request.data.low = ~data.at(0x100);
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.type = C65_ACTION_READ_BYTE;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.low != data.at(0x100));
+
+			// Test #6: Invalid region
+			region.data = &data[0];
+			address.word = 0x1001;
+			ASSERT(c65_region(address, ADDRESS_PAGE_LENGTH, &region) == EXIT_FAILURE);
+			address.word = 0x1000;
+			ASSERT(c65_region(address, ADDRESS_PAGE_LENGTH + 1, &region) == EXIT_FAILURE);
+			ASSERT(c65_region(address, 0, &region) == EXIT_FAILURE);
+			address.word = 0xff00;
+			ASSERT(c65_region(address, ADDRESS_PAGE_LENGTH * 2, &region) == EXIT_FAILURE);
+
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.address.word = ADDRESS_MEMORY_STACK_BEGIN;
+			request.data.low = ~data.at(0);
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			address.word = ADDRESS_MEMORY_STACK_BEGIN;
+			ASSERT(c65_region(address, (UINT32_MAX - ADDRESS_PAGE_LENGTH + 1), &region) == EXIT_FAILURE);
+			request.type = C65_ACTION_READ_BYTE;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(response.data.low == (c65_byte_t)~data.at(0));
+
+			region = {};
+			ASSERT(c65_region(address, ADDRESS_PAGE_LENGTH, &region) == EXIT_FAILURE);
+
 			TRACE_EXIT();
 		}
 
@@ -494,5 +1321,193 @@ namespace c65 {
 
 			TRACE_EXIT();
 		}
+
+		void
+		runtime::test_watch(void)
+		{
+			c65_byte_t value;
+			c65_watch_t watch = {};
+			c65_address_t address = {};
+			c65_action_t request = {}, response = {};
+
+			TRACE_ENTRY();
+
+			ASSERT(c65_event_handler(C65_EVENT_WATCH, c65_event_counter) == EXIT_SUCCESS);
+			ASSERT(c65_event_handler(C65_EVENT_WATCH_READ, c65_event_counter) == EXIT_SUCCESS);
+
+			// Test #1: Read watch
+			address.word = ADDRESS_VIDEO_BEGIN;
+			watch.type = MASK(C65_WATCH_READ);
+			ASSERT(c65_watch(address, ADDRESS_LENGTH(ADDRESS_VIDEO_BEGIN, ADDRESS_VIDEO_END), &watch) == EXIT_SUCCESS);
+
+			address.word = ADDRESS_MEMORY_HIGH_BEGIN;
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.address = address;
+			request.data.low = INSTRUCTION_TYPE_LDA_ABSOLUTE;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.type = C65_ACTION_WRITE_WORD;
+			++request.address.word;
+			request.data.word = ADDRESS_VIDEO_END;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(c65_reset() == EXIT_SUCCESS);
+			request.type = C65_ACTION_WRITE_REGISTER;
+			request.address.word = C65_REGISTER_PROGRAM_COUNTER;
+			request.data.word = address.word;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			EVENT_COUNT = 0;
+			request.type = C65_ACTION_READ_BYTE;
+			request.address.word = ADDRESS_VIDEO_END;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.type = C65_ACTION_READ_WORD;
+			--request.address.word;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(c65_read_block(&value, sizeof(value), request.address) == EXIT_SUCCESS);
+			ASSERT(!EVENT_COUNT);
+			ASSERT(c65_step() == EXIT_SUCCESS);
+			ASSERT(EVENT_COUNT == 1);
+			ASSERT(c65_unload(address, INSTRUCTION_LENGTH_WORD + 1) == EXIT_SUCCESS);
+
+			// Test #2: Write watch
+			address.word = ADDRESS_MEMORY_HIGH_BEGIN;
+			watch.type = MASK(C65_WATCH_WRITE);
+			ASSERT(c65_watch(address, ADDRESS_PAGE_LENGTH, &watch) == EXIT_SUCCESS);
+
+			EVENT_COUNT = 0;
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.address.word = (ADDRESS_MEMORY_HIGH_BEGIN + UINT8_MAX);
+			request.data.low = MEMORY_ZERO;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.type = C65_ACTION_READ_BYTE;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(EVENT_COUNT == 1);
+
+			// Test #3: Value watch
+			watch.type = (MASK(C65_WATCH_WRITE) | MASK(C65_WATCH_VALUE));
+			watch.value = MEMORY_FILL;
+			ASSERT(c65_watch(address, ADDRESS_PAGE_LENGTH, &watch) == EXIT_SUCCESS);
+
+			EVENT_COUNT = 0;
+			request.type = C65_ACTION_WRITE_BYTE;
+			request.data.low = MEMORY_ZERO;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(!EVENT_COUNT);
+			request.data.low = MEMORY_FILL;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(EVENT_COUNT == 1);
+
+			// Test #4: Bank switch
+			request.type = C65_ACTION_WRITE_BANKING;
+			request.data.word = true;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			address.word = ADDRESS_MEMORY_BANK;
+			watch.type = MASK(C65_WATCH_WRITE);
+			ASSERT(c65_watch(address, 1, &watch) == EXIT_SUCCESS);
+
+			EVENT_COUNT = 0;
+			address.word = ADDRESS_MEMORY_BANK_BEGIN;
+			ASSERT(c65_unload_bank(address, ADDRESS_PAGE_LENGTH, MEMORY_BANK_COUNT) == EXIT_SUCCESS);
+			ASSERT(!EVENT_COUNT);
+			address.word = ADDRESS_MEMORY_BANK;
+			ASSERT(c65_watch(address, 1, nullptr) == EXIT_SUCCESS);
+
+			request.data.word = false;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			// Test #5: Clear watch
+			address.word = ADDRESS_MEMORY_HIGH_BEGIN;
+			ASSERT(c65_watch(address, ADDRESS_PAGE_LENGTH, nullptr) == EXIT_SUCCESS);
+			address.word = ADDRESS_VIDEO_BEGIN;
+			ASSERT(c65_watch(address, ADDRESS_LENGTH(ADDRESS_VIDEO_BEGIN, ADDRESS_VIDEO_END), nullptr) == EXIT_SUCCESS);
+
+			EVENT_COUNT = 0;
+			request.type = C65_ACTION_WRITE_BYTE;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			request.type = C65_ACTION_READ_BYTE;
+			request.address.word = ADDRESS_VIDEO_END;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(!EVENT_COUNT);
+
+			// Test #6: Invalid watch
+			ASSERT(c65_watch(address, 0, nullptr) == EXIT_FAILURE);
+			address.word = UINT16_MAX;
+			ASSERT(c65_watch(address, ADDRESS_PAGE_LENGTH, nullptr) == EXIT_FAILURE);
+			address.word = ADDRESS_VIDEO_BEGIN;
+			ASSERT(c65_watch(address, (UINT32_MAX - ADDRESS_VIDEO_BEGIN + 1), nullptr) == EXIT_FAILURE);
+			watch.type = 0;
+			ASSERT(c65_watch(address, ADDRESS_PAGE_LENGTH, &watch) == EXIT_FAILURE);
+			watch.type = MASK(C65_WATCH_VALUE);
+			ASSERT(c65_watch(address, ADDRESS_PAGE_LENGTH, &watch) == EXIT_FAILURE);
+			watch.type = (WATCH_MASK + 1);
+			ASSERT(c65_watch(address, ADDRESS_PAGE_LENGTH, &watch) == EXIT_FAILURE);
+
+			ASSERT(c65_event_handler(C65_EVENT_WATCH, nullptr) == EXIT_SUCCESS);
+			ASSERT(c65_event_handler(C65_EVENT_WATCH_READ, nullptr) == EXIT_SUCCESS);
+
+			TRACE_EXIT();
+		}
+
+		void
+		runtime::test_write_block(void)
+		{
+			std::vector<c65_byte_t> data;
+			c65_action_t request = {}, response = {};
+			c65_address_t address = {}, length = {};
+
+			TRACE_ENTRY();
+
+			length.word = (ADDRESS_PAGE_LENGTH * 2);
+			data.resize(length.word, MEMORY_ZERO);
+
+			for(address.word = 0; address.word < length.word; ++address.word) {
+				data.at(address.word) = std::rand();
+			}
+
+			// Test #1: Valid write
+			address.word = (ADDRESS_MEMORY_HIGH_BEGIN + (ADDRESS_PAGE_LENGTH / 2));
+			ASSERT(c65_write_block((c65_byte_t *)&data[0], length.word, address) == EXIT_SUCCESS);
+
+			for(request.address = address; request.address.word < (address.word + length.word); ++request.address.word) {
+				request.type = C65_ACTION_READ_BYTE;
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+				ASSERT(response.data.low == data.at(request.address.word - address.word));
+			}
+
+			ASSERT(c65_unload(address, length.word) == EXIT_SUCCESS);
+
+			// Test #2: Device write
+			address.word = ADDRESS_VIDEO_BEGIN;
+			ASSERT(c65_write_block((c65_byte_t *)&data[0], length.word, address) == EXIT_SUCCESS);
+
+			for(request.address = address; request.address.word < (address.word + length.word); ++request.address.word) {
+				request.type = C65_ACTION_READ_BYTE;
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+				ASSERT(response.data.low == data.at(request.address.word - address.word));
+			}
+
+			ASSERT(c65_unload(address, length.word) == EXIT_SUCCESS);
+
+			// Test #3: Read-only write
+			address.word = ADDRESS_MEMORY_HIGH_BEGIN;
+			request.type = C65_ACTION_WRITE_ATTRIBUTE;
+			request.address = address;
+			request.data.word = MASK(C65_ATTRIBUTE_READ_ONLY);
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+			ASSERT(c65_write_block((c65_byte_t *)&data[0], ADDRESS_PAGE_LENGTH, address) == EXIT_SUCCESS);
+
+			for(request.address = address; request.address.word < (address.word + ADDRESS_PAGE_LENGTH); ++request.address.word) {
+				request.type = C65_ACTION_READ_BYTE;
+				ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+				ASSERT(response.data.low == MEMORY_FILL);
+			}
+
+			request.type = C65_ACTION_WRITE_ATTRIBUTE;
+			request.address = address;
+			request.data.word = 0;
+			ASSERT(c65_action(&request, &response) == EXIT_SUCCESS);
+
+			TRACE_EXIT();
+		}
 	}
 }
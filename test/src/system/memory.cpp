@@ -45,6 +45,8 @@ namespace c65 {
 			{
 				TRACE_ENTRY_FORMAT("Quiet=%x", quiet);
 
+				EXECUTE_TEST(test_bank, quiet);
+				EXECUTE_TEST(test_data, quiet);
 				EXECUTE_TEST(test_read, quiet);
 				EXECUTE_TEST(test_write, quiet);
 
@@ -65,6 +67,95 @@ namespace c65 {
 				TRACE_EXIT();
 			}
 
+			void
+			memory::test_bank(void)
+			{
+				c65_address_t address = {}, bank = {};
+				c65_byte_t value = (MEMORY_FILL + 1);
+
+				TRACE_ENTRY();
+
+				c65::system::memory &instance = c65::system::memory::instance();
+
+				instance.initialize();
+
+				bank.word = ADDRESS_MEMORY_BANK;
+				address.word = ADDRESS_MEMORY_BANK_BEGIN;
+				ASSERT(!instance.read_bank());
+
+				// Test #1: Select extended bank
+				for(int index = 1; index <= MEMORY_BANK_COUNT; index += (MEMORY_BANK_COUNT - 1)) {
+					instance.write_bank(index);
+					ASSERT(instance.read_bank() == index);
+					ASSERT(instance.read(bank) == MEMORY_ZERO);
+					ASSERT(instance.read(address) == MEMORY_FILL);
+					instance.write(address, value + index);
+					ASSERT(instance.read(address) == (c65_byte_t)(value + index));
+					ASSERT(*instance.data(address) == (c65_byte_t)(value + index));
+				}
+
+				// Test #2: Select base bank
+				instance.write_bank(0);
+				ASSERT(instance.read(address) == MEMORY_FILL);
+				ASSERT(*instance.data(address) == MEMORY_FILL);
+				address.word = (ADDRESS_MEMORY_BANK_BEGIN - 1);
+				instance.write(address, value);
+				instance.write_bank(1);
+				ASSERT(instance.read(address) == value);
+
+				// Test #3: Reselect extended bank
+				address.word = ADDRESS_MEMORY_BANK_END;
+				instance.write_bank(1);
+				ASSERT(instance.read(address) == MEMORY_FILL);
+				address.word = ADDRESS_MEMORY_BANK_BEGIN;
+				ASSERT(instance.read(address) == (c65_byte_t)(value + 1));
+				instance.write_bank(MEMORY_BANK_COUNT);
+				ASSERT(instance.read(address) == (c65_byte_t)(value + MEMORY_BANK_COUNT));
+
+				instance.uninitialize();
+
+				TRACE_EXIT();
+			}
+
+			void
+			memory::test_data(void)
+			{
+				c65_address_t address = {};
+				c65_byte_t value = std::rand();
+
+				TRACE_ENTRY();
+
+				c65::system::memory &instance = c65::system::memory::instance();
+
+				instance.initialize();
+
+				do {
+
+					switch(address.word) {
+
+						// Test #1: Valid range
+						case ADDRESS_MEMORY_HIGH_BEGIN ... ADDRESS_MEMORY_HIGH_END:
+						case ADDRESS_MEMORY_STACK_BEGIN ... ADDRESS_MEMORY_STACK_END:
+						case ADDRESS_MEMORY_ZERO_PAGE_BEGIN ... ADDRESS_MEMORY_ZERO_PAGE_END:
+							ASSERT(instance.data(address));
+							*instance.data(address) = value;
+							ASSERT(instance.read(address) == value);
+							break;
+
+						// Test #2: Invalid range
+						default:
+							ASSERT(!instance.data(address));
+							break;
+					}
+
+					++address.word;
+				} while(address.word);
+
+				instance.uninitialize();
+
+				TRACE_EXIT();
+			}
+
 			void
 			memory::test_read(void)
 			{
@@ -126,9 +217,6 @@ namespace c65 {
 
 						// Test #1: Valid range
 						case ADDRESS_MEMORY_HIGH_BEGIN ... ADDRESS_MEMORY_HIGH_END:
-							instance.write(address, value);
-							ASSERT(instance.read(address) == value);
-							break;
 						case ADDRESS_MEMORY_STACK_BEGIN ... ADDRESS_MEMORY_STACK_END:
 						case ADDRESS_MEMORY_ZERO_PAGE_BEGIN ... ADDRESS_MEMORY_ZERO_PAGE_END:
 							instance.write(address, value);
@@ -26,7 +26,8 @@ namespace c65 {
 
 		namespace system {
 
-			processor::processor(void)
+			processor::processor(void) :
+				m_access(0)
 			{
 				TRACE_ENTRY();
 				TRACE_EXIT();
@@ -71,6 +72,9 @@ namespace c65 {
 				) const
 			{
 				TRACE_ENTRY_FORMAT("Event=%p", &event);
+
+				m_elapsed.push_back(c65::system::processor::instance().elapsed());
+
 				TRACE_EXIT();
 			}
 
@@ -84,6 +88,8 @@ namespace c65 {
 				TRACE_ENTRY_FORMAT("Address=%u(%04x)", address.word, address.word);
 
 				result = m_memory.at(address.word);
+				m_sequence.push_back(address.word);
+				++m_access;
 
 				TRACE_EXIT_FORMAT("Result=%u(%02x)", result, result);
 				return result;
@@ -97,6 +103,7 @@ namespace c65 {
 				TRACE_ENTRY_FORMAT("Quiet=%x", quiet);
 
 				EXECUTE_TEST(test_execute_add, quiet);
+				EXECUTE_TEST(test_execute_add_decimal, quiet);
 				EXECUTE_TEST(test_execute_and, quiet);
 				EXECUTE_TEST(test_execute_bit, quiet);
 				EXECUTE_TEST(test_execute_branch, quiet);
@@ -134,6 +141,7 @@ namespace c65 {
 				EXECUTE_TEST(test_execute_store_index_y, quiet);
 				EXECUTE_TEST(test_execute_store_zero, quiet);
 				EXECUTE_TEST(test_execute_subtract, quiet);
+				EXECUTE_TEST(test_execute_subtract_decimal, quiet);
 				EXECUTE_TEST(test_execute_test_reset_bit, quiet);
 				EXECUTE_TEST(test_execute_test_set_bit, quiet);
 				EXECUTE_TEST(test_execute_transfer, quiet);
@@ -141,18 +149,25 @@ namespace c65 {
 				EXECUTE_TEST(test_execute_xor, quiet);
 				EXECUTE_TEST(test_interrupt, quiet);
 				EXECUTE_TEST(test_interrupt_pending, quiet);
+				EXECUTE_TEST(test_invalidate, quiet);
 				EXECUTE_TEST(test_read, quiet);
+				EXECUTE_TEST(test_read_engine, quiet);
 				EXECUTE_TEST(test_read_register, quiet);
 				EXECUTE_TEST(test_read_status, quiet);
+				EXECUTE_TEST(test_read_timing, quiet);
 				EXECUTE_TEST(test_reset, quiet);
+				EXECUTE_TEST(test_run, quiet);
 				EXECUTE_TEST(test_stack_overflow, quiet);
 				EXECUTE_TEST(test_stack_underflow, quiet);
 				EXECUTE_TEST(test_step, quiet);
+				EXECUTE_TEST(test_step_block, quiet);
 				EXECUTE_TEST(test_stopped, quiet);
 				EXECUTE_TEST(test_waiting, quiet);
 				EXECUTE_TEST(test_write, quiet);
+				EXECUTE_TEST(test_write_engine, quiet);
 				EXECUTE_TEST(test_write_register, quiet);
 				EXECUTE_TEST(test_write_status, quiet);
+				EXECUTE_TEST(test_write_timing, quiet);
 
 				TRACE_EXIT();
 			}
@@ -187,6 +202,9 @@ namespace c65 {
 				TRACE_ENTRY_FORMAT("Address=%u(%04x), Value=%u(%02x)", address.word, address.word, value, value);
 
 				m_memory.at(address.word) = value;
+				c65::system::processor::instance().invalidate(address);
+				m_sequence.push_back(address.word);
+				++m_access;
 
 				TRACE_EXIT();
 			}
@@ -515,6 +533,83 @@ namespace c65 {
 				TRACE_EXIT();
 			}
 
+			void
+			processor::test_execute_add_decimal(void)
+			{
+				c65_status_t status;
+				c65_address_t address, operand;
+				int accumulator, carry, value;
+
+				TRACE_ENTRY();
+
+				clear_memory();
+				c65::system::processor &instance = c65::system::processor::instance();
+
+				instance.initialize();
+				instance.reset(*this);
+
+				address.word = INTERRUPT_VECTOR_ADDRESS(INTERRUPT_VECTOR_RESET);
+				operand.word = (address.word + 1);
+				m_memory.at(address.word) = INSTRUCTION_TYPE_ADC_IMMEDIATE;
+
+				// Test #1: ADC #, decimal mode, all operands
+				for(carry = 0; carry <= 1; ++carry) {
+
+					for(accumulator = 0; accumulator <= UINT8_MAX; ++accumulator) {
+
+						for(value = 0; value <= UINT8_MAX; ++value) {
+							int low, sum;
+							bool carry_out, overflow;
+
+							low = ((accumulator & 0x0f) + (value & 0x0f) + carry);
+							if(low >= 0x0a) {
+								low = (((low + 0x06) & 0x0f) + 0x10);
+							}
+
+							sum = ((int8_t)(accumulator & 0xf0) + (int8_t)(value & 0xf0) + low);
+							overflow = ((sum < INT8_MIN) || (sum > INT8_MAX));
+
+							sum = ((accumulator & 0xf0) + (value & 0xf0) + low);
+							if(sum >= 0xa0) {
+								sum += 0x60;
+							}
+
+							carry_out = (sum > UINT8_MAX);
+
+							if(((accumulator & 0x0f) <= 9) && (accumulator <= 0x99) && ((value & 0x0f) <= 9) && (value <= 0x99)) {
+								int decimal = ((((accumulator >> 4) * 10) + (accumulator & 0x0f))
+									+ (((value >> 4) * 10) + (value & 0x0f)) + carry);
+
+								ASSERT(carry_out == (decimal >= 100));
+								decimal %= 100;
+								ASSERT((sum & UINT8_MAX) == (((decimal / 10) << 4) | (decimal % 10)));
+							}
+
+							status.raw = MASK(FLAG_UNUSED);
+							status.carry = carry;
+							status.decimal_mode = true;
+							instance.write_status(status);
+							instance.write_register(C65_REGISTER_ACCUMULATOR, {{(c65_byte_t)accumulator, 0x00}});
+							instance.write_register(C65_REGISTER_PROGRAM_COUNTER, address);
+							write(operand, value);
+
+							ASSERT(instance.step(*this) == (INSTRUCTION(INSTRUCTION_TYPE_ADC_IMMEDIATE).cycle + 1));
+							ASSERT(instance.read_register(C65_REGISTER_ACCUMULATOR).low == (sum & UINT8_MAX));
+
+							status = instance.read_status();
+							ASSERT(status.carry == carry_out);
+							ASSERT(status.overflow == overflow);
+							ASSERT(status.zero == !(sum & UINT8_MAX));
+							ASSERT(status.negative == MASK_CHECK(sum, FLAG_NEGATIVE));
+						}
+					}
+				}
+
+				instance.uninitialize();
+
+				TRACE_EXIT();
+			}
+
 			void
 			processor::test_execute_and(void)
 			{
@@ -5825,6 +5920,81 @@ namespace c65 {
 				TRACE_EXIT();
 			}
 
+			void
+			processor::test_execute_subtract_decimal(void)
+			{
+				c65_status_t status;
+				c65_address_t address, operand;
+				int accumulator, carry, value;
+
+				TRACE_ENTRY();
+
+				clear_memory();
+				c65::system::processor &instance = c65::system::processor::instance();
+
+				instance.initialize();
+				instance.reset(*this);
+
+				address.word = INTERRUPT_VECTOR_ADDRESS(INTERRUPT_VECTOR_RESET);
+				operand.word = (address.word + 1);
+				m_memory.at(address.word) = INSTRUCTION_TYPE_SBC_IMMEDIATE;
+
+				// Test #1: SBC #, decimal mode, all operands
+				for(carry = 0; carry <= 1; ++carry) {
+
+					for(accumulator = 0; accumulator <= UINT8_MAX; ++accumulator) {
+
+						for(value = 0; value <= UINT8_MAX; ++value) {
+							int low, sum;
+							bool carry_out, overflow;
+
+							low = ((accumulator & 0x0f) - (value & 0x0f) + carry - 1);
+							sum = (accumulator - value + carry - 1);
+							overflow = MASK_CHECK((accumulator ^ value) & (accumulator ^ sum) & MASK(FLAG_NEGATIVE), FLAG_NEGATIVE);
+							carry_out = (sum >= 0);
+
+							if(sum < 0) {
+								sum -= 0x60;
+							}
+
+							if(low < 0) {
+								sum -= 0x06;
+							}
+
+							if(((accumulator & 0x0f) <= 9) && (accumulator <= 0x99) && ((value & 0x0f) <= 9) && (value <= 0x99)) {
+								int decimal = ((((accumulator >> 4) * 10) + (accumulator & 0x0f))
+									- (((value >> 4) * 10) + (value & 0x0f)) + carry - 1);
+
+								ASSERT(carry_out == (decimal >= 0));
+								decimal = ((decimal + 100) % 100);
+								ASSERT((sum & UINT8_MAX) == (((decimal / 10) << 4) | (decimal % 10)));
+							}
+
+							status.raw = MASK(FLAG_UNUSED);
+							status.carry = carry;
+							status.decimal_mode = true;
+							instance.write_status(status);
+							instance.write_register(C65_REGISTER_ACCUMULATOR, {{(c65_byte_t)accumulator, 0x00}});
+							instance.write_register(C65_REGISTER_PROGRAM_COUNTER, address);
+							write(operand, value);
+
+							ASSERT(instance.step(*this) == (INSTRUCTION(INSTRUCTION_TYPE_SBC_IMMEDIATE).cycle + 1));
+							ASSERT(instance.read_register(C65_REGISTER_ACCUMULATOR).low == (sum & UINT8_MAX));
+
+							status = instance.read_status();
+							ASSERT(status.carry == carry_out);
+							ASSERT(status.overflow == overflow);
+							ASSERT(status.zero == !(sum & UINT8_MAX));
+							ASSERT(status.negative == MASK_CHECK(sum, FLAG_NEGATIVE));
+						}
+					}
+				}
+
+				instance.uninitialize();
+
+				TRACE_EXIT();
+			}
+
 			void
 			processor::test_execute_test_reset_bit(void)
 			{
@@ -6783,6 +6953,57 @@ namespace c65 {
 				TRACE_EXIT();
 			}
 
+			void
+			processor::test_invalidate(void)
+			{
+				c65_address_t address;
+
+				TRACE_ENTRY();
+
+				clear_memory();
+				c65::system::processor &instance = c65::system::processor::instance();
+
+				instance.initialize();
+				instance.reset(*this);
+
+				address.word = INTERRUPT_VECTOR_ADDRESS(INTERRUPT_VECTOR_RESET);
+				m_memory.at(address.word) = INSTRUCTION_TYPE_LDA_IMMEDIATE;
+				m_memory.at(address.word + 1) = 0x10;
+				ASSERT(instance.step(*this) == INSTRUCTION(INSTRUCTION_TYPE_LDA_IMMEDIATE).cycle);
+				ASSERT(instance.read_register(C65_REGISTER_ACCUMULATOR).low == 0x10);
+
+				// Test #1: Cached instruction
+				m_memory.at(address.word + 1) = 0x20;
+				instance.write_register(C65_REGISTER_PROGRAM_COUNTER, address);
+				ASSERT(instance.step(*this) == INSTRUCTION(INSTRUCTION_TYPE_LDA_IMMEDIATE).cycle);
+				ASSERT(instance.read_register(C65_REGISTER_ACCUMULATOR).low == 0x10);
+
+				// Test #2: Invalidated operand
+				address.word = (INTERRUPT_VECTOR_ADDRESS(INTERRUPT_VECTOR_RESET) + 1);
+				instance.invalidate(address);
+				address.word = INTERRUPT_VECTOR_ADDRESS(INTERRUPT_VECTOR_RESET);
+				instance.write_register(C65_REGISTER_PROGRAM_COUNTER, address);
+				ASSERT(instance.step(*this) == INSTRUCTION(INSTRUCTION_TYPE_LDA_IMMEDIATE).cycle);
+				ASSERT(instance.read_register(C65_REGISTER_ACCUMULATOR).low == 0x20);
+
+				// Test #3: Invalidated opcode
+				m_memory.at(address.word) = INSTRUCTION_TYPE_LDX_IMMEDIATE;
+				instance.invalidate(address);
+				instance.write_register(C65_REGISTER_PROGRAM_COUNTER, address);
+				ASSERT(instance.step(*this) == INSTRUCTION(INSTRUCTION_TYPE_LDX_IMMEDIATE).cycle);
+				ASSERT(instance.read_register(C65_REGISTER_INDEX_X).low == 0x20);
+
+				// Test #4: Reset
+				m_memory.at(address.word) = INSTRUCTION_TYPE_LDY_IMMEDIATE;
+				instance.reset(*this);
+				ASSERT(instance.step(*this) == INSTRUCTION(INSTRUCTION_TYPE_LDY_IMMEDIATE).cycle);
+				ASSERT(instance.read_register(C65_REGISTER_INDEX_Y).low == 0x20);
+
+				instance.uninitialize();
+
+				TRACE_EXIT();
+			}
+
 			void
 			processor::test_read(void)
 			{
@@ -6815,6 +7036,22 @@ namespace c65 {
 				TRACE_EXIT();
 			}
 
+			void
+			processor::test_read_engine(void)
+			{
+				TRACE_ENTRY();
+
+				c65::system::processor &instance = c65::system::processor::instance();
+
+				instance.initialize();
+
+				ASSERT(instance.read_engine() == C65_ENGINE_INTERPRETER);
+
+				instance.uninitialize();
+
+				TRACE_EXIT();
+			}
+
 			void
 			processor::test_read_register(void)
 			{
@@ -6883,6 +7120,22 @@ namespace c65 {
 				TRACE_EXIT();
 			}
 
+			void
+			processor::test_read_timing(void)
+			{
+				TRACE_ENTRY();
+
+				c65::system::processor &instance = c65::system::processor::instance();
+
+				instance.initialize();
+
+				ASSERT(instance.read_timing() == C65_TIMING_FAST);
+
+				instance.uninitialize();
+
+				TRACE_EXIT();
+			}
+
 			void
 			processor::test_reset(void)
 			{
@@ -6912,6 +7165,128 @@ namespace c65 {
 				TRACE_EXIT();
 			}
 
+			void
+			processor::test_run(void)
+			{
+				uint32_t cycle;
+				c65_address_t address;
+				address_set_t breakpoint;
+
+				TRACE_ENTRY();
+
+				clear_memory();
+				c65::system::processor &instance = c65::system::processor::instance();
+
+				instance.initialize();
+
+				address.word = INTERRUPT_VECTOR_ADDRESS(INTERRUPT_VECTOR_RESET);
+				m_memory.at(address.word) = INSTRUCTION_TYPE_LDA_IMMEDIATE;
+				m_memory.at(address.word + 1) = 0x10;
+				m_memory.at(address.word + 2) = INSTRUCTION_TYPE_LDX_IMMEDIATE;
+				m_memory.at(address.word + 3) = 0x20;
+				m_memory.at(address.word + 4) = INSTRUCTION_TYPE_INY_IMPLIED;
+				m_memory.at(address.word + 5) = INSTRUCTION_TYPE_JMP_ABSOLUTE;
+				m_memory.at(address.word + 6) = address.low;
+				m_memory.at(address.word + 7) = address.high;
+
+				cycle = (INSTRUCTION(INSTRUCTION_TYPE_LDA_IMMEDIATE).cycle + INSTRUCTION(INSTRUCTION_TYPE_LDX_IMMEDIATE).cycle
+					+ INSTRUCTION(INSTRUCTION_TYPE_INY_IMPLIED).cycle + INSTRUCTION(INSTRUCTION_TYPE_JMP_ABSOLUTE).cycle);
+
+				// Test #1: Cycle budget
+				instance.reset(*this);
+				ASSERT(instance.run(*this, cycle * 4, nullptr) == (cycle * 4));
+				ASSERT(instance.read_register(C65_REGISTER_INDEX_Y).low == 4);
+				ASSERT(instance.read_register(C65_REGISTER_PROGRAM_COUNTER).word == address.word);
+
+				instance.reset(*this);
+				instance.write_engine(C65_ENGINE_BLOCK);
+				ASSERT(instance.run(*this, cycle * 4, nullptr) == (cycle * 4));
+				ASSERT(instance.read_register(C65_REGISTER_INDEX_Y).low == 4);
+				instance.write_engine(C65_ENGINE_INTERPRETER);
+
+				// Test #2: Breakpoint
+				breakpoint.set(address.word + 4);
+				instance.reset(*this);
+				ASSERT(instance.run(*this, cycle * 4, &breakpoint) == (INSTRUCTION(INSTRUCTION_TYPE_LDA_IMMEDIATE).cycle
+					+ INSTRUCTION(INSTRUCTION_TYPE_LDX_IMMEDIATE).cycle));
+				ASSERT(instance.read_register(C65_REGISTER_PROGRAM_COUNTER).word == (address.word + 4));
+				ASSERT(instance.run(*this, cycle * 4, &breakpoint) == cycle);
+				ASSERT(instance.read_register(C65_REGISTER_PROGRAM_COUNTER).word == (address.word + 4));
+
+				// Test #3: Stop
+				m_memory.at(address.word + 4) = INSTRUCTION_TYPE_STP_STATE;
+				instance.reset(*this);
+				ASSERT(instance.run(*this, cycle * 4, nullptr) == (INSTRUCTION(INSTRUCTION_TYPE_LDA_IMMEDIATE).cycle
+					+ INSTRUCTION(INSTRUCTION_TYPE_LDX_IMMEDIATE).cycle + INSTRUCTION(INSTRUCTION_TYPE_STP_STATE).cycle));
+				ASSERT(instance.stopped());
+				ASSERT(instance.run(*this, UINT16_MAX, nullptr) == UINT16_MAX);
+				ASSERT(instance.stopped());
+
+				// Test #4: Elapsed cycles
+				for(int engine = C65_ENGINE_INTERPRETER; engine <= C65_ENGINE_MAX; ++engine) {
+					instance.write_engine(engine);
+					instance.reset(*this);
+					m_elapsed.clear();
+					instance.run(*this, cycle * 4, nullptr);
+					ASSERT(m_elapsed.size() == 1);
+					ASSERT(m_elapsed.front() == (INSTRUCTION(INSTRUCTION_TYPE_LDA_IMMEDIATE).cycle
+						+ INSTRUCTION(INSTRUCTION_TYPE_LDX_IMMEDIATE).cycle));
+					ASSERT(!instance.elapsed());
+				}
+
+				instance.write_engine(C65_ENGINE_INTERPRETER);
+
+				// Test #5: Wait
+				m_memory.at(address.word + 4) = INSTRUCTION_TYPE_WAI_STATE;
+				instance.reset(*this);
+				ASSERT(instance.run(*this, cycle * 4, nullptr) == (INSTRUCTION(INSTRUCTION_TYPE_LDA_IMMEDIATE).cycle
+					+ INSTRUCTION(INSTRUCTION_TYPE_LDX_IMMEDIATE).cycle + INSTRUCTION(INSTRUCTION_TYPE_WAI_STATE).cycle));
+				ASSERT(instance.waiting());
+				ASSERT(instance.run(*this, UINT16_MAX, nullptr) == UINT16_MAX);
+				ASSERT(instance.waiting());
+				instance.interrupt(C65_INTERRUPT_MASKABLE);
+				ASSERT(instance.run(*this, UINT16_MAX, nullptr) == UINT16_MAX);
+				ASSERT(instance.waiting());
+				instance.reset(*this);
+				instance.run(*this, cycle * 4, nullptr);
+				instance.interrupt(C65_INTERRUPT_NON_MASKABLE);
+				instance.run(*this, UINT16_MAX, nullptr);
+				ASSERT(!instance.interrupt_pending());
+
+				// Test #6: Idle loop
+				m_memory.at(address.word) = INSTRUCTION_TYPE_LDA_ABSOLUTE;
+				m_memory.at(address.word + 1) = 0x00;
+				m_memory.at(address.word + 2) = 0x20;
+				m_memory.at(address.word + 3) = INSTRUCTION_TYPE_BEQ_RELATIVE;
+				m_memory.at(address.word + 4) = 0xfb;
+				m_memory.at(address.word + 5) = INSTRUCTION_TYPE_STP_STATE;
+				m_memory.at(0x2000) = 0;
+
+				for(int engine = C65_ENGINE_INTERPRETER; engine <= C65_ENGINE_MAX; ++engine) {
+					instance.reset(*this);
+					instance.write_engine(engine);
+					m_access = 0;
+					ASSERT(instance.run(*this, UINT16_MAX, nullptr) == UINT16_MAX);
+					ASSERT(instance.read_register(C65_REGISTER_PROGRAM_COUNTER).word == address.word);
+					ASSERT(m_access < 8);
+					ASSERT(!instance.stopped());
+				}
+
+				instance.write_engine(C65_ENGINE_INTERPRETER);
+
+				// Test #7: Non-idle loop
+				m_memory.at(address.word) = INSTRUCTION_TYPE_INC_ABSOLUTE;
+				m_memory.at(address.word + 3) = INSTRUCTION_TYPE_BNE_RELATIVE;
+				instance.reset(*this);
+				ASSERT(instance.run(*this, UINT16_MAX, nullptr) < UINT16_MAX);
+				ASSERT(instance.stopped());
+				ASSERT(!m_memory.at(0x2000));
+
+				instance.uninitialize();
+
+				TRACE_EXIT();
+			}
+
 			void
 			processor::test_stack_overflow(void)
 			{
@@ -6960,6 +7335,77 @@ namespace c65 {
 				TRACE_EXIT();
 			}
 
+			void
+			processor::test_step_block(void)
+			{
+				c65_address_t address, target;
+
+				TRACE_ENTRY();
+
+				clear_memory();
+				c65::system::processor &instance = c65::system::processor::instance();
+
+				instance.initialize();
+
+				address.word = INTERRUPT_VECTOR_ADDRESS(INTERRUPT_VECTOR_RESET);
+				m_memory.at(address.word) = INSTRUCTION_TYPE_LDA_IMMEDIATE;
+				m_memory.at(address.word + 1) = 0x10;
+				m_memory.at(address.word + 2) = INSTRUCTION_TYPE_LDX_IMMEDIATE;
+				m_memory.at(address.word + 3) = 0x20;
+				m_memory.at(address.word + 4) = INSTRUCTION_TYPE_INY_IMPLIED;
+				m_memory.at(address.word + 5) = INSTRUCTION_TYPE_JMP_ABSOLUTE;
+				m_memory.at(address.word + 6) = address.low;
+				m_memory.at(address.word + 7) = address.high;
+
+				// Test #1: Interpreter engine
+				instance.reset(*this);
+				ASSERT(instance.step_block(*this) == INSTRUCTION(INSTRUCTION_TYPE_LDA_IMMEDIATE).cycle);
+				ASSERT(instance.read_register(C65_REGISTER_ACCUMULATOR).low == 0x10);
+				ASSERT(instance.read_register(C65_REGISTER_INDEX_X).low == 0);
+
+				// Test #2: Block engine
+				instance.reset(*this);
+				instance.write_engine(C65_ENGINE_BLOCK);
+				ASSERT(instance.step_block(*this) == (INSTRUCTION(INSTRUCTION_TYPE_LDA_IMMEDIATE).cycle
+					+ INSTRUCTION(INSTRUCTION_TYPE_LDX_IMMEDIATE).cycle + INSTRUCTION(INSTRUCTION_TYPE_INY_IMPLIED).cycle
+					+ INSTRUCTION(INSTRUCTION_TYPE_JMP_ABSOLUTE).cycle));
+				ASSERT(instance.read_register(C65_REGISTER_ACCUMULATOR).low == 0x10);
+				ASSERT(instance.read_register(C65_REGISTER_INDEX_X).low == 0x20);
+				ASSERT(instance.read_register(C65_REGISTER_INDEX_Y).low == 1);
+				ASSERT(instance.read_register(C65_REGISTER_PROGRAM_COUNTER).word == address.word);
+
+				// Test #3: Invalidated block
+				target.word = (address.word + 3);
+				write(target, 0x30);
+				instance.step_block(*this);
+				ASSERT(instance.read_register(C65_REGISTER_INDEX_X).low == 0x30);
+				ASSERT(instance.read_register(C65_REGISTER_INDEX_Y).low == 2);
+
+				// Test #4: Self-modifying block
+				target.word = (address.word + 6);
+				m_memory.at(address.word + 1) = 0x40;
+				m_memory.at(address.word + 2) = INSTRUCTION_TYPE_STA_ABSOLUTE;
+				m_memory.at(address.word + 3) = target.low;
+				m_memory.at(address.word + 4) = target.high;
+				m_memory.at(address.word + 5) = INSTRUCTION_TYPE_LDX_IMMEDIATE;
+				m_memory.at(address.word + 6) = 0;
+				m_memory.at(address.word + 7) = INSTRUCTION_TYPE_JMP_ABSOLUTE;
+				m_memory.at(address.word + 8) = address.low;
+				m_memory.at(address.word + 9) = address.high;
+				instance.reset(*this);
+				instance.write_engine(C65_ENGINE_BLOCK);
+				ASSERT(instance.step_block(*this) == (INSTRUCTION(INSTRUCTION_TYPE_LDA_IMMEDIATE).cycle
+					+ INSTRUCTION(INSTRUCTION_TYPE_STA_ABSOLUTE).cycle));
+				ASSERT(instance.step_block(*this) == (INSTRUCTION(INSTRUCTION_TYPE_LDX_IMMEDIATE).cycle
+					+ INSTRUCTION(INSTRUCTION_TYPE_JMP_ABSOLUTE).cycle));
+				ASSERT(instance.read_register(C65_REGISTER_INDEX_X).low == 0x40);
+				ASSERT(instance.read_register(C65_REGISTER_PROGRAM_COUNTER).word == address.word);
+
+				instance.uninitialize();
+
+				TRACE_EXIT();
+			}
+
 			void
 			processor::test_stopped(void)
 			{
@@ -7027,6 +7473,34 @@ namespace c65 {
 				TRACE_EXIT();
 			}
 
+			void
+			processor::test_write_engine(void)
+			{
+				int type = 0;
+
+				TRACE_ENTRY();
+
+				c65::system::processor &instance = c65::system::processor::instance();
+
+				instance.initialize();
+
+				// Test #1: Valid engine
+				for(; type <= C65_ENGINE_MAX; ++type) {
+					instance.write_engine(type);
+					ASSERT(instance.read_engine() == type);
+				}
+
+				// Test #2: Invalid engine
+				try {
+					instance.write_engine(C65_ENGINE_MAX + 1);
+					ASSERT(false);
+				} catch(...) { }
+
+				instance.uninitialize();
+
+				TRACE_EXIT();
+			}
+
 			void
 			processor::test_write_register(void)
 			{
@@ -7085,9 +7559,114 @@ namespace c65 {
 
 				instance.initialize();
 
-				value.raw = std::rand();
-				instance.write_status(value);
-				ASSERT(instance.read_status().raw == value.raw);
+				do {
+					instance.write_status(value);
+					ASSERT(instance.read_status().raw == value.raw);
+				} while(++value.raw);
+
+				instance.uninitialize();
+
+				TRACE_EXIT();
+			}
+
+			void
+			processor::test_write_timing(void)
+			{
+				int type = 0;
+				uint8_t cycle;
+				c65_status_t status;
+				c65_register_t stack = {};
+				c65_address_t address, interrupt, target, vector;
+
+				TRACE_ENTRY();
+
+				clear_memory();
+				c65::system::processor &instance = c65::system::processor::instance();
+
+				instance.initialize();
+
+				// Test #1: Valid timing
+				for(; type <= C65_TIMING_MAX; ++type) {
+					instance.write_timing(type);
+					ASSERT(instance.read_timing() == type);
+				}
+
+				// Test #2: Invalid timing
+				try {
+					instance.write_timing(C65_TIMING_MAX + 1);
+					ASSERT(false);
+				} catch(...) { }
+
+				// Test #3: Exact timing
+				address.word = INTERRUPT_VECTOR_ADDRESS(INTERRUPT_VECTOR_RESET);
+				target.word = 0x1000;
+				interrupt.word = INTERRUPT_VECTOR_ADDRESS(INTERRUPT_VECTOR_MASKABLE);
+				stack.word = ADDRESS_MEMORY_STACK_END;
+				m_memory.at(address.word) = INSTRUCTION_TYPE_LDA_IMMEDIATE;
+				m_memory.at(address.word + 1) = 0x10;
+				m_memory.at(address.word + 2) = INSTRUCTION_TYPE_INC_ABSOLUTE;
+				m_memory.at(address.word + 3) = 0x00;
+				m_memory.at(address.word + 4) = 0x20;
+				m_memory.at(address.word + 5) = INSTRUCTION_TYPE_LDA_ABSOLUTE_INDEX_X;
+				m_memory.at(address.word + 6) = 0xff;
+				m_memory.at(address.word + 7) = target.high;
+				m_memory.at(address.word + 8) = INSTRUCTION_TYPE_PHA_STACK;
+				m_memory.at(address.word + 9) = INSTRUCTION_TYPE_JSR_ABSOLUTE;
+				m_memory.at(address.word + 10) = target.low;
+				m_memory.at(address.word + 11) = target.high;
+				m_memory.at(address.word + 12) = INSTRUCTION_TYPE_NOP_IMPLIED;
+				m_memory.at(target.word) = INSTRUCTION_TYPE_RTS_RETURN;
+				m_memory.at(interrupt.word) = INSTRUCTION_TYPE_NOP_IMPLIED;
+
+				instance.reset(*this);
+				vector.word = ADDRESS_PROCESSOR_MASKABLE_BEGIN;
+				instance.write(vector, interrupt.low);
+				vector.word = ADDRESS_PROCESSOR_MASKABLE_END;
+				instance.write(vector, interrupt.high);
+				instance.write_timing(C65_TIMING_EXACT);
+				instance.write_register(C65_REGISTER_INDEX_X, {{0x01, 0x00}});
+				instance.write_register(C65_REGISTER_STACK_POINTER, stack);
+				status = instance.read_status();
+				status.interrupt_disable = false;
+				instance.write_status(status);
+
+				const std::vector<std::vector<c65_word_t>> sequence = {
+					// lda #: opcode, operand
+					{ (c65_word_t)address.word, (c65_word_t)(address.word + 1) },
+					// inc a: opcode, operand, read, dummy read, write
+					{ (c65_word_t)(address.word + 2), (c65_word_t)(address.word + 3), (c65_word_t)(address.word + 4),
+						0x2000, 0x2000, 0x2000 },
+					// lda a, x: opcode, operand, re-read of the last operand byte on the page crossing, read
+					{ (c65_word_t)(address.word + 5), (c65_word_t)(address.word + 6), (c65_word_t)(address.word + 7),
+						(c65_word_t)(address.word + 7), (c65_word_t)(target.word + 0x100) },
+					// pha: opcode, internal, push
+					{ (c65_word_t)(address.word + 8), (c65_word_t)(address.word + 9), stack.word },
+					// jsr a: opcode, low byte, internal, push high, push low, high byte
+					{ (c65_word_t)(address.word + 9), (c65_word_t)(address.word + 10), (c65_word_t)(stack.word - 1),
+						(c65_word_t)(stack.word - 1), (c65_word_t)(stack.word - 2), (c65_word_t)(address.word + 11) },
+					// rts: opcode, internal, internal, pull low, pull high, re-read of the return address
+					{ target.word, (c65_word_t)(target.word + 1), (c65_word_t)(stack.word - 3), (c65_word_t)(stack.word - 2),
+						(c65_word_t)(stack.word - 1), (c65_word_t)(address.word + 11) },
+					// irq: discarded opcode, internal, push high, push low, push status, vector; then nop: opcode, internal
+					{ (c65_word_t)(address.word + 12), (c65_word_t)(address.word + 12), (c65_word_t)(stack.word - 1),
+						(c65_word_t)(stack.word - 2), (c65_word_t)(stack.word - 3), ADDRESS_PROCESSOR_MASKABLE_BEGIN,
+						ADDRESS_PROCESSOR_MASKABLE_END, interrupt.word, (c65_word_t)(interrupt.word + 1) },
+					};
+
+				for(const std::vector<c65_word_t> &entry : sequence) {
+
+					if(entry.front() == (address.word + 12)) {
+						instance.interrupt(C65_INTERRUPT_MASKABLE);
+					}
+
+					m_access = 0;
+					m_sequence.clear();
+					cycle = instance.step(*this);
+					ASSERT(m_access == cycle);
+					ASSERT(m_sequence == entry);
+				}
+
+				ASSERT(instance.read_register(C65_REGISTER_PROGRAM_COUNTER).word == (interrupt.word + 1));
 
 				instance.uninitialize();
 
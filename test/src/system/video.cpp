@@ -46,6 +46,9 @@ namespace c65 {
 				TRACE_ENTRY_FORMAT("Quiet=%x", quiet);
 
 				EXECUTE_TEST(test_clear, quiet);
+				EXECUTE_TEST(test_data, quiet);
+				EXECUTE_TEST(test_fill, quiet);
+				EXECUTE_TEST(test_load, quiet);
 				EXECUTE_TEST(test_read, quiet);
 				EXECUTE_TEST(test_write, quiet);
 
@@ -93,6 +96,113 @@ namespace c65 {
 				TRACE_EXIT();
 			}
 
+			void
+			video::test_data(void)
+			{
+				c65_address_t address = {};
+				c65_byte_t value = (std::rand() % COLOR_MAX);
+
+				TRACE_ENTRY();
+
+				c65::system::video &instance = c65::system::video::instance();
+
+				instance.initialize();
+
+				// Test #1: Valid range
+				for(address.word = ADDRESS_VIDEO_BEGIN; address.word <= ADDRESS_VIDEO_END; ++address.word) {
+					ASSERT(instance.data(address));
+					instance.write(address, value);
+					ASSERT(*instance.data(address) == value);
+				}
+
+				// Test #2: Invalid range
+				ASSERT(!instance.data(address));
+
+				instance.uninitialize();
+
+				TRACE_EXIT();
+			}
+
+			void
+			video::test_fill(void)
+			{
+				c65_address_t address = {};
+				c65_byte_t value = (std::rand() % COLOR_MAX);
+
+				TRACE_ENTRY();
+
+				c65::system::video &instance = c65::system::video::instance();
+
+				instance.initialize();
+
+				// Test #1: Valid range
+				address.word = ADDRESS_VIDEO_BEGIN;
+				instance.fill(address, ADDRESS_LENGTH(ADDRESS_VIDEO_BEGIN, ADDRESS_VIDEO_END), value);
+
+				for(; address.word <= ADDRESS_VIDEO_END; ++address.word) {
+					ASSERT(instance.read(address) == value);
+				}
+
+				// Test #2: Invalid range
+				try {
+					instance.fill(address, 1, value);
+					ASSERT(false);
+				} catch(...) { }
+
+				try {
+					address.word = ADDRESS_VIDEO_END;
+					instance.fill(address, 2, value);
+					ASSERT(false);
+				} catch(...) { }
+
+				instance.uninitialize();
+
+				TRACE_EXIT();
+			}
+
+			void
+			video::test_load(void)
+			{
+				std::vector<c65_byte_t> data;
+				c65_address_t address = {};
+
+				TRACE_ENTRY();
+
+				c65::system::video &instance = c65::system::video::instance();
+
+				instance.initialize();
+
+				data.resize(ADDRESS_LENGTH(ADDRESS_VIDEO_BEGIN, ADDRESS_VIDEO_END));
+
+				for(c65_byte_t &value : data) {
+					value = (std::rand() % COLOR_MAX);
+				}
+
+				// Test #1: Valid range
+				address.word = ADDRESS_VIDEO_BEGIN;
+				instance.load(&data[0], data.size(), address);
+
+				for(; address.word <= ADDRESS_VIDEO_END; ++address.word) {
+					ASSERT(instance.read(address) == data.at(address.word - ADDRESS_VIDEO_BEGIN));
+				}
+
+				// Test #2: Invalid range
+				try {
+					instance.load(&data[0], 1, address);
+					ASSERT(false);
+				} catch(...) { }
+
+				try {
+					address.word = ADDRESS_VIDEO_END;
+					instance.load(&data[0], 2, address);
+					ASSERT(false);
+				} catch(...) { }
+
+				instance.uninitialize();
+
+				TRACE_EXIT();
+			}
+
 			void
 			video::test_read(void)
 			{
@@ -0,0 +1,168 @@
+/**
+ * C65
+ * Copyright (C) 2019 David Jolly
+ *
+ * C65 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * C65 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/type/mapping.h"
+#include "../../include/type/mapping.h"
+#include "./mapping_type.h"
+
+namespace c65 {
+
+	namespace test {
+
+		namespace type {
+
+			mapping::mapping(void)
+			{
+				TRACE_ENTRY();
+				TRACE_EXIT();
+			}
+
+			mapping::~mapping(void)
+			{
+				TRACE_ENTRY();
+				TRACE_EXIT();
+			}
+
+			void
+			mapping::create_file(
+				__in const std::string &path,
+				__in_opt const std::vector<c65_byte_t> &data
+				)
+			{
+				std::ofstream file;
+
+				TRACE_ENTRY_FORMAT("Path[%u]=%s, Data[%u]=%p", path.size(), STRING(path), data.size(), &data);
+
+				file = std::ofstream(STRING(path), std::ios::binary | std::ios::out | std::ios::trunc);
+				if(!file) {
+					THROW_C65_TEST_TYPE_MAPPING_EXCEPTION_FORMAT(C65_TEST_TYPE_MAPPING_EXCEPTION_FILE_INVALID,
+						"%s", STRING(path));
+				}
+
+				if(!data.empty()) {
+					file.write((char *)&data[0], data.size());
+				}
+
+				file.close();
+
+				TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Created file", "%s, %.02f KB (%u bytes)", STRING(path),
+					data.size() / (float)std::kilo::num, data.size());
+
+				TRACE_EXIT();
+			}
+
+			void
+			mapping::destroy_file(
+				__in const std::string &path
+				)
+			{
+				TRACE_ENTRY_FORMAT("Path[%u]=%s", path.size(), STRING(path));
+
+				std::remove(STRING(path));
+
+				TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Destroyed file", "%s", STRING(path));
+
+				TRACE_EXIT();
+			}
+
+			void
+			mapping::on_run(
+				__in bool quiet
+				)
+			{
+				TRACE_ENTRY_FORMAT("Quiet=%x", quiet);
+
+				EXECUTE_TEST(test_map_file, quiet);
+
+				TRACE_EXIT();
+			}
+
+			void
+			mapping::on_setup(void)
+			{
+				int type = 0;
+
+				TRACE_ENTRY();
+
+				for(; type <= FILE_MAX; ++type) {
+					create_file(FILE_STRING(type), FILE_DATA(type));
+				}
+
+				TRACE_EXIT();
+			}
+
+			void
+			mapping::on_teardown(void)
+			{
+				int type = 0;
+
+				TRACE_ENTRY();
+
+				for(; type <= FILE_MAX; ++type) {
+					destroy_file(FILE_STRING(type));
+				}
+
+				TRACE_EXIT();
+			}
+
+			void
+			mapping::test_map_file(void)
+			{
+				size_t index = 0;
+				std::vector<c65_byte_t> data;
+				c65::type::mapping mapping;
+
+				TRACE_ENTRY();
+
+				// Test #1: Empty file
+				mapping.map(FILE_STRING(FILE_EMPTY));
+				ASSERT(!mapping.mapped());
+				ASSERT(mapping.empty());
+				ASSERT(!mapping.size());
+				mapping.unmap();
+
+				// Test #2: Non-empty file
+				data = FILE_DATA(FILE_FULL);
+				mapping.map(FILE_STRING(FILE_FULL));
+
+				ASSERT(mapping.mapped());
+				ASSERT(mapping.size() == data.size());
+
+				for(; index < data.size(); ++index) {
+					ASSERT(mapping.data()[index] == data.at(index));
+				}
+
+				// Test #3: Unmap file
+				mapping.unmap();
+				ASSERT(!mapping.mapped());
+				ASSERT(!mapping.data());
+				ASSERT(mapping.empty());
+
+				// Test #4: Invalid file
+				try {
+					mapping.map(FILE_INVALID);
+					ASSERT(false);
+				} catch(...) {
+					ASSERT(!mapping.mapped());
+				}
+
+				TRACE_EXIT();
+			}
+		}
+	}
+}
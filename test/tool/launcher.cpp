@@ -21,6 +21,7 @@
 #include "../include/system/processor.h"
 #include "../include/system/video.h"
 #include "../include/type/buffer.h"
+#include "../include/type/mapping.h"
 #include "../include/c65.h"
 #include "./launcher_type.h"
 
@@ -188,6 +189,7 @@ namespace c65 {
 						int result = EXIT_SUCCESS;
 						c65::test::runtime runtime;
 						c65::test::type::buffer buffer;
+						c65::test::type::mapping mapping;
 						c65::test::system::video video;
 						c65::test::system::memory memory;
 						c65::test::system::processor processor;
@@ -203,6 +205,7 @@ namespace c65 {
 						fixtures.insert(std::make_pair("c65::system::processor", &processor));
 						fixtures.insert(std::make_pair("c65::system::video", &video));
 						fixtures.insert(std::make_pair("c65::type::buffer", &buffer));
+						fixtures.insert(std::make_pair("c65::type::mapping", &mapping));
 
 						for(fixture = fixtures.begin(); fixture != fixtures.end(); ++fixture) {
 							std::string error;
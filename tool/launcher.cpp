@@ -19,7 +19,7 @@
 #include <readline/history.h>
 #include <readline/readline.h>
 #include "../include/interface/singleton.h"
-#include "../include/type/buffer.h"
+#include "../include/type/mapping.h"
 #include "../include/c65.h"
 #include "./launcher_type.h"
 
@@ -264,16 +264,24 @@ namespace c65 {
 					__in const std::vector<std::string> &arguments
 					)
 				{
+					std::string text;
 					std::stringstream stream;
+					std::vector<c65_condition_t> condition;
 					c65_action_t request = {}, response = {};
+					std::vector<c65_condition_t>::const_iterator entry;
 
 					TRACE_ENTRY_FORMAT("Argument[%u]=%p", arguments.size(), &arguments);
 
 					stream << std::hex << arguments.front();
 					stream >> request.address.word;
 
-					TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Breakpoint", "%u(%04x)",
-						request.address.word, request.address.word);
+					if(arguments.size() > 1) {
+						text = arguments.back();
+						condition = debug_condition(text);
+					}
+
+					TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Breakpoint", "%u(%04x), %s",
+						request.address.word, request.address.word, STRING(text));
 
 					if(m_breakpoint.find(request.address.word) != m_breakpoint.end()) {
 						THROW_C65_TOOL_LAUNCHER_EXCEPTION_FORMAT(C65_TOOL_LAUNCHER_EXCEPTION_BREAKPOINT_DUPLICATE,
@@ -286,7 +294,16 @@ namespace c65 {
 						THROW_C65_TOOL_LAUNCHER_EXCEPTION_FORMAT(C65_TOOL_LAUNCHER_EXCEPTION_INTERNAL, "%s", c65_error());
 					}
 
-					m_breakpoint.insert(request.address.word);
+					m_breakpoint[request.address.word] = text;
+					request.type = C65_ACTION_BREAKPOINT_CONDITION;
+
+					for(entry = condition.begin(); entry != condition.end(); ++entry) {
+						request.condition = *entry;
+
+						if(c65_action(&request, &response) != EXIT_SUCCESS) {
+							THROW_C65_TOOL_LAUNCHER_EXCEPTION_FORMAT(C65_TOOL_LAUNCHER_EXCEPTION_INTERNAL, "%s", c65_error());
+						}
+					}
 
 					TRACE_EXIT();
 				}
@@ -297,7 +314,7 @@ namespace c65 {
 				{
 					std::stringstream stream;
 					c65_action_t request = {}, response = {};
-					std::set<c65_word_t>::iterator breakpoint;
+					std::map<c65_word_t, std::string>::iterator breakpoint;
 
 					TRACE_ENTRY_FORMAT("Argument[%u]=%p", arguments.size(), &arguments);
 
@@ -328,7 +345,7 @@ namespace c65 {
 				{
 					size_t index = 0;
 					std::stringstream result;
-					std::set<c65_word_t>::const_iterator breakpoint;
+					std::map<c65_word_t, std::string>::const_iterator breakpoint;
 
 					TRACE_ENTRY();
 
@@ -338,7 +355,11 @@ namespace c65 {
 
 					for(breakpoint = m_breakpoint.begin(); breakpoint != m_breakpoint.end(); ++breakpoint, ++index) {
 						result << std::endl << "[" << index << STRING_COLUMN_SHORT() << "]"
-							<< STRING_WORD(*breakpoint);
+							<< STRING_WORD(breakpoint->first);
+
+						if(!breakpoint->second.empty()) {
+							result << " " << breakpoint->second;
+						}
 					}
 
 					std::cout << LEVEL_COLOR(LEVEL_VERBOSE) << result.str() << LEVEL_COLOR(LEVEL_NONE) << std::endl;
@@ -406,6 +427,8 @@ namespace c65 {
 					c65_address_t address;
 					c65_word_t count, end, offset;
 					std::stringstream result, stream;
+					std::vector<c65_byte_t> data;
+					std::vector<c65_byte_t>::iterator byte;
 
 					TRACE_ENTRY_FORMAT("Argument[%u]=%p", arguments.size(), &arguments);
 
@@ -443,9 +466,14 @@ namespace c65 {
 						result << " --";
 					}
 
-					for(; address.word != end; ++address.word) {
+					data.resize((c65_word_t)(end - address.word));
+
+					if(c65_read_block(data.data(), data.size(), address) != EXIT_SUCCESS) {
+						THROW_C65_TOOL_LAUNCHER_EXCEPTION_FORMAT(C65_TOOL_LAUNCHER_EXCEPTION_INTERNAL, "%s", c65_error());
+					}
+
+					for(byte = data.begin(); byte != data.end(); ++address.word, ++byte) {
 						char value;
-						c65_action_t request = {}, response = {};
 
 						if(!(address.word % BLOCK_WIDTH)) {
 
@@ -457,24 +485,10 @@ namespace c65 {
 							result << std::endl << STRING_WORD(address.word) << " |";
 						}
 
-						request.type = C65_ACTION_READ_BYTE;
-						request.address = address;
-
-						TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Request", "%i(%s), %u(%04x)",
-							request.type, ACTION_STRING(request.type), request.address.word, request.address.word);
-
-						if(c65_action(&request, &response) != EXIT_SUCCESS) {
-							THROW_C65_TOOL_LAUNCHER_EXCEPTION_FORMAT(C65_TOOL_LAUNCHER_EXCEPTION_INTERNAL, "%s",
-								c65_error());
-						}
-
-						TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Response", "%i(%s), %u(%02x)",
-							response.type, ACTION_STRING(response.type), response.data.low, response.data.low);
-
-						value = (char)response.data.low;
+						value = (char)*byte;
 						buffer += ((std::isprint(value) && !std::isspace(value)) ? value : CHARACTER_FILL);
 
-						result << " " << STRING_BYTE(response.data.low);
+						result << " " << STRING_BYTE(*byte);
 					}
 
 					if(!buffer.empty()) {
@@ -875,7 +889,10 @@ namespace c65 {
 				void debug_action_stack(void)
 				{
 					c65_word_t depth;
+					c65_address_t address;
 					std::stringstream result;
+					std::vector<c65_byte_t> data;
+					std::vector<c65_byte_t>::iterator byte;
 					c65_action_t request = {}, response = {};
 
 					TRACE_ENTRY();
@@ -915,20 +932,16 @@ namespace c65 {
 
 					result << "]" << std::endl;
 
-					request.type = C65_ACTION_READ_BYTE;
-
-					while(depth) {
-						request.address.word = (ADDRESS_MEMORY_STACK_END - depth + 1);
+					address.word = (ADDRESS_MEMORY_STACK_END - depth + 1);
+					data.resize(depth);
 
-						if(c65_action(&request, &response) != EXIT_SUCCESS) {
-							THROW_C65_TOOL_LAUNCHER_EXCEPTION_FORMAT(C65_TOOL_LAUNCHER_EXCEPTION_INTERNAL,
-								"%s", c65_error());
-						}
-
-						result << std::endl << "[" << STRING_WORD(request.address.word)
-							<< STRING_COLUMN_SHORT() << "]" << STRING_BYTE(response.data.low);
+					if(c65_read_block(data.data(), data.size(), address) != EXIT_SUCCESS) {
+						THROW_C65_TOOL_LAUNCHER_EXCEPTION_FORMAT(C65_TOOL_LAUNCHER_EXCEPTION_INTERNAL, "%s", c65_error());
+					}
 
-						--depth;
+					for(byte = data.begin(); byte != data.end(); ++address.word, ++byte) {
+						result << std::endl << "[" << STRING_WORD(address.word)
+							<< STRING_COLUMN_SHORT() << "]" << STRING_BYTE(*byte);
 					}
 
 					std::cout << LEVEL_COLOR(LEVEL_VERBOSE) << result.str()	<< LEVEL_COLOR(LEVEL_NONE) << std::endl;
@@ -1309,6 +1322,106 @@ namespace c65 {
 					TRACE_EXIT();
 				}
 
+				std::vector<c65_condition_t> debug_condition(
+					__in const std::string &argument
+					)
+				{
+					std::string term;
+					std::stringstream stream(argument);
+					std::vector<c65_condition_t> result;
+
+					TRACE_ENTRY_FORMAT("Argument=%s", STRING(argument));
+
+					while(std::getline(stream, term, CONDITION_DELIMITER)) {
+						int compare = 0;
+						size_t position;
+						std::string expression, operand;
+						c65_dword_t value = 0;
+						std::stringstream value_stream;
+						c65_condition_t condition = {};
+
+						position = term.find_first_of("=!<>");
+						if(!position || (position == std::string::npos)) {
+							THROW_C65_TOOL_LAUNCHER_EXCEPTION_FORMAT(C65_TOOL_LAUNCHER_EXCEPTION_CONDITION_INVALID, "%s",
+								STRING(term));
+						}
+
+						operand = term.substr(0, position);
+						expression = term.substr(position);
+
+						for(; compare <= C65_COMPARE_MAX; ++compare) {
+							const std::string &str = COMPARE_STR[compare];
+
+							if(!expression.compare(0, str.size(), str) && ((expression.size() == str.size())
+									|| std::isxdigit(expression.at(str.size())))) {
+								break;
+							}
+						}
+
+						if(compare > C65_COMPARE_MAX) {
+							THROW_C65_TOOL_LAUNCHER_EXCEPTION_FORMAT(C65_TOOL_LAUNCHER_EXCEPTION_CONDITION_INVALID, "%s",
+								STRING(term));
+						}
+
+						value_stream << std::hex << expression.substr(COMPARE_STR[compare].size());
+						value_stream >> value;
+
+						if(value_stream.fail() || !value_stream.eof()) {
+							THROW_C65_TOOL_LAUNCHER_EXCEPTION_FORMAT(C65_TOOL_LAUNCHER_EXCEPTION_CONDITION_INVALID, "%s",
+								STRING(term));
+						}
+
+						condition.compare = compare;
+
+						if(operand == CONDITION_HIT) {
+							condition.type = C65_CONDITION_HIT;
+						} else if(ACTION_REGISTER_SUPPORTED(operand)) {
+							condition.type = C65_CONDITION_REGISTER;
+							condition.operand = ACTION_REGISTER_TYPE(operand);
+						} else if((operand.size() > 2) && (operand.front() == CONDITION_MEMORY_OPEN)
+								&& (operand.back() == CONDITION_MEMORY_CLOSE)) {
+							c65_word_t address = 0;
+							std::stringstream address_stream;
+
+							address_stream << std::hex << operand.substr(1, operand.size() - 2);
+							address_stream >> address;
+
+							if(address_stream.fail() || !address_stream.eof()) {
+								THROW_C65_TOOL_LAUNCHER_EXCEPTION_FORMAT(C65_TOOL_LAUNCHER_EXCEPTION_CONDITION_INVALID,
+									"%s", STRING(term));
+							}
+
+							condition.type = C65_CONDITION_MEMORY;
+							condition.operand = address;
+						} else {
+							int flag = 0;
+
+							for(; flag <= FLAG_MAX; ++flag) {
+
+								if((flag != FLAG_UNUSED) && (operand.size() == 1)
+										&& (std::toupper(operand.front()) == FLAG_STR[flag].front())) {
+									break;
+								}
+							}
+
+							if(flag > FLAG_MAX) {
+								THROW_C65_TOOL_LAUNCHER_EXCEPTION_FORMAT(C65_TOOL_LAUNCHER_EXCEPTION_CONDITION_INVALID,
+									"%s", STRING(term));
+							}
+
+							condition.type = C65_CONDITION_STATUS;
+							condition.operand = MASK(flag);
+							value = (value ? condition.operand : 0);
+						}
+
+						condition.value = value;
+						result.push_back(condition);
+					}
+
+					TRACE_EXIT_FORMAT("Result=%u", result.size());
+					return result;
+				}
+
 				int debug_console(void)
 				{
 					bool complete = false;
@@ -1363,7 +1476,8 @@ namespace c65 {
 							}
 
 							type = ACTION_TYPE(action);
-							if(arguments.size() != ACTION_ARGUMENT_LENGTH(type)) {
+							if((arguments.size() < ACTION_ARGUMENT_LENGTH(type))
+									|| (arguments.size() > (ACTION_ARGUMENT_LENGTH(type) + ACTION_ARGUMENT_OPTIONAL(type)))) {
 								THROW_C65_TOOL_LAUNCHER_EXCEPTION_FORMAT(
 									C65_TOOL_LAUNCHER_EXCEPTION_ARGUMENT_MISMATCH, "%s", STRING(m_command));
 							}
@@ -1497,7 +1611,9 @@ namespace c65 {
 								result << ": " << STRING_WORD(event->address.word);
 								break;
 							case C65_EVENT_ILLEGAL_INSTRUCTION:
+							case C65_EVENT_PROTECTION_FAULT:
 							case C65_EVENT_WATCH:
+							case C65_EVENT_WATCH_READ:
 								result << ": " << STRING_WORD(event->address.word) << ", "
 									<< STRING_BYTE(event->data.low);
 								break;
@@ -1643,18 +1759,18 @@ namespace c65 {
 					)
 				{
 					size_t result;
-					c65::type::buffer data;
+					c65::type::mapping data;
 
 					TRACE_ENTRY_FORMAT("Path[%u]=%s, Base=%u(%04x)", path.size(), STRING(path), base.word, base.word);
 
-					data.load(path);
+					data.map(path);
 					result = data.size();
 
 					TRACE_MESSAGE_FORMAT(LEVEL_INFORMATION, "Load", "%s, %.02f KB (%u bytes), %u(%04x)",
-						STRING(path), data.size() / (float)std::kilo::num, data.size(),
+						STRING(path), result / (float)std::kilo::num, result,
 						base.word, base.word);
 
-					if(c65_load((c65_byte_t *)&data[0], data.size(), base) != EXIT_SUCCESS) {
+					if(c65_load(data.data(), result, base) != EXIT_SUCCESS) {
 						THROW_C65_TOOL_LAUNCHER_EXCEPTION_FORMAT(C65_TOOL_LAUNCHER_EXCEPTION_INTERNAL, "%s", c65_error());
 					}
 
@@ -1830,7 +1946,7 @@ namespace c65 {
 
 				c65_address_t m_base;
 
-				std::set<c65_word_t> m_breakpoint;
+				std::map<c65_word_t, std::string> m_breakpoint;
 
 				std::string m_command;
 
@@ -40,6 +40,7 @@ namespace c65 {
 			C65_TOOL_LAUNCHER_EXCEPTION_ARGUMENT_UNDEFINED,
 			C65_TOOL_LAUNCHER_EXCEPTION_BREAKPOINT_DUPLICATE,
 			C65_TOOL_LAUNCHER_EXCEPTION_BREAKPOINT_NOT_FOUND,
+			C65_TOOL_LAUNCHER_EXCEPTION_CONDITION_INVALID,
 			C65_TOOL_LAUNCHER_EXCEPTION_INTERNAL,
 			C65_TOOL_LAUNCHER_EXCEPTION_INTERRUPT_INVALID,
 			C65_TOOL_LAUNCHER_EXCEPTION_REGISTER_INVALID,
@@ -57,6 +58,7 @@ namespace c65 {
 			C65_TOOL_LAUNCHER_EXCEPTION_HEADER "Undefined argument", // C65_TOOL_LAUNCHER_EXCEPTION_ARGUMENT_UNDEFINED
 			C65_TOOL_LAUNCHER_EXCEPTION_HEADER "Duplicate breakpoint", // C65_TOOL_LAUNCHER_EXCEPTION_BREAKPOINT_DUPLICATE
 			C65_TOOL_LAUNCHER_EXCEPTION_HEADER "Breakpoint does not exist", // C65_TOOL_LAUNCHER_EXCEPTION_BREAKPOINT_NOT_FOUND
+			C65_TOOL_LAUNCHER_EXCEPTION_HEADER "Invalid condition", // C65_TOOL_LAUNCHER_EXCEPTION_CONDITION_INVALID
 			C65_TOOL_LAUNCHER_EXCEPTION_HEADER "Internal exception", // C65_TOOL_LAUNCHER_EXCEPTION_INTERNAL
 			C65_TOOL_LAUNCHER_EXCEPTION_HEADER "Invalid interrupt", // C65_TOOL_LAUNCHER_EXCEPTION_INTERRUPT_INVALID
 			C65_TOOL_LAUNCHER_EXCEPTION_HEADER "Invalid register", // C65_TOOL_LAUNCHER_EXCEPTION_REGISTER_INVALID
@@ -140,9 +142,11 @@ namespace c65 {
 		#define ACTION_ARGUMENT_LENGTH(_TYPE_) \
 			(((_TYPE_) > ACTION_MAX) ? 0 : \
 				ACTION_ARGUMENT_LEN[_TYPE_])
+		#define ACTION_ARGUMENT_OPTIONAL(_TYPE_) \
+			(((_TYPE_) == ACTION_BREAKPOINT) ? 1 : 0)
 
 		static const std::string ACTION_ARGUMENT_STR[] = {
-			"<address>", // ACTION_BREAKPOINT
+			"<address> [cond]", // ACTION_BREAKPOINT
 			"<address>", // ACTION_BREAKPOINT_CLEAR
 			"", // ACTION_BREAKPOINT_LIST
 			"", // ACTION_CYCLE
@@ -389,6 +393,11 @@ namespace c65 {
 		#define ACTION_REGISTER_TYPE(_ARGUMENT_) \
 			ACTION_REGISTER_MAP.find(_ARGUMENT_)->second
 
+		#define CONDITION_DELIMITER ','
+		#define CONDITION_HIT "hit"
+		#define CONDITION_MEMORY_CLOSE ']'
+		#define CONDITION_MEMORY_OPEN '['
+
 		enum {
 			ARGUMENT_BASE = 0,
 			ARGUMENT_DEBUG,